@@ -0,0 +1,158 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+// Measures how the shared JobSystem scales with its worker count.
+//
+// The workload mimics the chunk pipeline without needing a GL context: every "terrain" job evaluates
+// the same 8-octave heightmap noise as SimpleTerrainGen and fills a chunk sized block array, then
+// submits a "mesh" job from inside the worker which scans that array for exposed faces.
+//
+// Usage: JobSystemBenchmark [chunkCount] [workerCount...]
+//        Defaults to 1024 chunks and 4, 8, 16, 32 workers.
+
+
+#include "Utils/JobSystem.h"
+
+#include <FastNoiseLite/FastNoiseLite.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <memory>
+#include <thread>
+#include <vector>
+
+
+namespace {
+
+    constexpr int c_ChunkSizeX = 16;
+    constexpr int c_ChunkSizeY = 384;
+    constexpr int c_ChunkSizeZ = 16;
+
+    using BlockArray = std::array<uint16_t, c_ChunkSizeX * c_ChunkSizeY * c_ChunkSizeZ>;
+
+    struct BenchState {
+        Mct::JobSystem*       Jobs = nullptr;
+        std::atomic<uint64_t> Checksum{ 0 };
+        std::atomic<size_t>   Remaining{ 0 };
+    };
+
+    void MeshJob(BenchState& state, std::shared_ptr<BlockArray> blocks) {
+        uint64_t faces = 0;
+
+        for (size_t i = 1; i < blocks->size(); ++i) {
+            faces += ((*blocks)[i] != 0) != ((*blocks)[i - 1] != 0);
+        }
+
+        state.Checksum.fetch_add(faces, std::memory_order_relaxed);
+
+        if (state.Remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            state.Remaining.notify_all();
+        }
+    }
+
+    void TerrainJob(BenchState& state, const int chunkX, const int chunkZ) {
+        FastNoiseLite noise(4346);
+        noise.SetNoiseType(FastNoiseLite::NoiseType_Perlin);
+        noise.SetFractalType(FastNoiseLite::FractalType_PingPong);
+        noise.SetFractalOctaves(8);
+        noise.SetFrequency(0.001f);
+
+        auto blocks = std::make_shared<BlockArray>();
+
+        for (int x = 0; x < c_ChunkSizeX; ++x) {
+            for (int z = 0; z < c_ChunkSizeZ; ++z) {
+                const float n = noise.GetNoise(float(chunkX * c_ChunkSizeX + x), float(chunkZ * c_ChunkSizeZ + z));
+                const int   h = 64 + static_cast<int>((n + 1.0f) * 0.5f * 150.0f);
+
+                for (int y = 0; y < c_ChunkSizeY; ++y) {
+                    (*blocks)[(x * c_ChunkSizeY + y) * c_ChunkSizeZ + z] = (y <= h) ? 1 : 0;
+                }
+            }
+        }
+
+        state.Jobs->Submit(Mct::JobKind::Mesh, Mct::JobPriority::High, [&state, blocks] {
+            MeshJob(state, blocks);
+        });
+    }
+
+    double RunOnce(const size_t workerCount, const int chunkCount, uint64_t& outChecksum) {
+        BenchState state;
+        state.Remaining.store(static_cast<size_t>(chunkCount));
+
+        Mct::JobSystem jobSystem(workerCount);
+        state.Jobs = &jobSystem;
+
+        const int side = 1 + static_cast<int>(std::sqrt(static_cast<double>(chunkCount)));
+
+        std::vector<Mct::JobSystem::JobDesc> jobs;
+        jobs.reserve(chunkCount);
+
+        for (int i = 0; i < chunkCount; ++i) {
+            jobs.push_back({
+                .Kind     { Mct::JobKind::Terrain    },
+                .Priority { Mct::JobPriority::Normal },
+                .Job      { [&state, x = i % side, z = i / side] { TerrainJob(state, x, z); } }
+            });
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+
+        jobSystem.SubmitBatch(std::move(jobs));
+
+        for (size_t remaining = state.Remaining.load(); remaining != 0; remaining = state.Remaining.load()) {
+            state.Remaining.wait(remaining);
+        }
+
+        const auto end = std::chrono::steady_clock::now();
+
+        outChecksum = state.Checksum.load();
+        return std::chrono::duration<double>(end - start).count();
+    }
+
+}
+
+
+int main(int argc, char** argv) {
+    int chunkCount = 1024;
+    std::vector<size_t> workerCounts;
+
+    if (argc > 1) {
+        chunkCount = std::max(1, std::atoi(argv[1]));
+    }
+
+    for (int i = 2; i < argc; ++i) {
+        workerCounts.push_back(static_cast<size_t>(std::max(1, std::atoi(argv[i]))));
+    }
+
+    if (workerCounts.empty()) {
+        workerCounts = { 4, 8, 16, 32 };
+    }
+
+    std::printf("JobSystem scaling: %d chunks, %u hardware threads\n",
+                chunkCount, std::thread::hardware_concurrency());
+    std::printf("%8s %12s %14s %10s\n", "workers", "seconds", "chunks/sec", "speedup");
+
+    double baseline = 0.0;
+
+    for (const size_t workerCount : workerCounts) {
+        uint64_t checksum = 0;
+        const double seconds = RunOnce(workerCount, chunkCount, checksum);
+
+        if (baseline == 0.0) {
+            baseline = seconds;
+        }
+
+        std::printf("%8zu %12.3f %14.1f %9.2fx   (checksum %llu)\n",
+                    workerCount, seconds, chunkCount / seconds, baseline / seconds,
+                    static_cast<unsigned long long>(checksum));
+    }
+
+    return 0;
+}
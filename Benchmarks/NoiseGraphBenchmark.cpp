@@ -0,0 +1,255 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+// Compares the fused noise graph kernels with the same graphs interpreted at runtime.
+//
+// The interpreted graphs are what configurable generator parameters look like the naive way: a tree
+// of nodes with virtual Eval calls per sample, the noise leaves going through BatchedNoise::GetNoise
+// with their settings read at runtime. The fused graphs are TerrainNoiseGraphs' own, one inlined
+// kernel per instruction set. Both fill chunk sized 16x16 grids like the heightfield generators.
+//
+// Usage: NoiseGraphBenchmark [chunkCount]
+//        Defaults to 1024 chunks.
+
+
+#include "World/WorldSettings.h"
+#include "World/TerrainGeneration/Noise/FusedNoise.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+
+namespace {
+
+    constexpr size_t c_ChunkSize    = 16;
+    constexpr size_t c_ChunkSamples = c_ChunkSize * c_ChunkSize;
+
+    namespace NG = Mct::NoiseGraph;
+
+    const int32_t c_Seed = Mct::WorldSettings{}.Seed;
+
+    struct Node {
+        virtual ~Node() = default;
+        virtual float Eval(float x, float z) const = 0;
+    };
+
+    using NodePtr = std::unique_ptr<Node>;
+
+    struct NoiseNode final : Node {
+        // The settings' seed is an offset from c_Seed, like in the graphs.
+        explicit NoiseNode(const Mct::NoiseSettings& settings) : Noise(WithSeed(settings), Mct::SimdLevel::Scalar) {}
+
+        static Mct::NoiseSettings WithSeed(Mct::NoiseSettings settings) {
+            settings.Seed += c_Seed;
+            return settings;
+        }
+
+        float Eval(const float x, const float z) const override { return Noise.GetNoise(x, z); }
+
+        Mct::BatchedNoise Noise;
+    };
+
+    struct ConstantNode final : Node {
+        explicit ConstantNode(const float value) : Value(value) {}
+
+        float Eval(float, float) const override { return Value; }
+
+        float Value;
+    };
+
+    struct AddNode final : Node {
+        AddNode(NodePtr a, NodePtr b) : A(std::move(a)), B(std::move(b)) {}
+
+        float Eval(const float x, const float z) const override { return A->Eval(x, z) + B->Eval(x, z); }
+
+        NodePtr A, B;
+    };
+
+    struct FloorNode final : Node {
+        explicit FloorNode(NodePtr source) : Source(std::move(source)) {}
+
+        float Eval(const float x, const float z) const override { return std::floor(Source->Eval(x, z)); }
+
+        NodePtr Source;
+    };
+
+    struct TruncNode final : Node {
+        explicit TruncNode(NodePtr source) : Source(std::move(source)) {}
+
+        float Eval(const float x, const float z) const override { return std::trunc(Source->Eval(x, z)); }
+
+        NodePtr Source;
+    };
+
+    struct RemapNode final : Node {
+        RemapNode(NodePtr source, const float inMin, const float inMax, const float outMin, const float outMax) :
+                Source ( std::move(source)      ),
+                InMin  ( inMin                  ),
+                Scale  ( 1.0f / (inMax - inMin) ),
+                OutMin ( outMin                 ),
+                Range  ( outMax - outMin        )
+        {}
+
+        float Eval(const float x, const float z) const override {
+            return OutMin + (Source->Eval(x, z) - InMin) * Scale * Range;
+        }
+
+        NodePtr Source;
+        float   InMin, Scale, OutMin, Range;
+    };
+
+    struct DomainWarpNode final : Node {
+        DomainWarpNode(NodePtr source, NodePtr warpX, NodePtr warpZ, const float amplitude) :
+                Source    ( std::move(source) ),
+                WarpX     ( std::move(warpX)  ),
+                WarpZ     ( std::move(warpZ)  ),
+                Amplitude ( amplitude         )
+        {}
+
+        float Eval(const float x, const float z) const override {
+            return Source->Eval(x + WarpX->Eval(x, z) * Amplitude, z + WarpZ->Eval(x, z) * Amplitude);
+        }
+
+        NodePtr Source, WarpX, WarpZ;
+        float   Amplitude;
+    };
+
+    struct BlendNode final : Node {
+        BlendNode(NodePtr selector, const float begin, const float end, NodePtr low, NodePtr high) :
+                Selector ( std::move(selector)  ),
+                Begin    ( begin                ),
+                Scale    ( 1.0f / (end - begin) ),
+                Low      ( std::move(low)       ),
+                High     ( std::move(high)      )
+        {}
+
+        float Eval(const float x, const float z) const override {
+            const float t      = std::clamp((Selector->Eval(x, z) - Begin) * Scale, 0.0f, 1.0f);
+            const float smooth = t * t * (3.0f - 2.0f * t);
+            const float low    = Low->Eval(x, z);
+
+            return low + (High->Eval(x, z) - low) * smooth;
+        }
+
+        NodePtr Selector;
+        float   Begin, Scale;
+        NodePtr Low, High;
+    };
+
+    // The interpreted twins of TerrainNoiseGraphs.
+    NodePtr BuildSimpleHeight() {
+        return std::make_unique<AddNode>(
+            std::make_unique<ConstantNode>(64.0f),
+            std::make_unique<TruncNode>(std::make_unique<RemapNode>(
+                std::make_unique<NoiseNode>(NG::c_SimpleHeightNoise), -1.0f, 1.0f, 0.0f, 150.0f)));
+    }
+
+    NodePtr BuildWarpedHeight() {
+        return std::make_unique<FloorNode>(std::make_unique<DomainWarpNode>(
+            std::make_unique<BlendNode>(
+                std::make_unique<NoiseNode>(NG::c_WarpedContinentNoise), -0.1f, 0.3f,
+                std::make_unique<RemapNode>(std::make_unique<NoiseNode>(NG::c_WarpedPlainsNoise), -1.0f, 1.0f, 62.0f,  78.0f),
+                std::make_unique<RemapNode>(std::make_unique<NoiseNode>(NG::c_WarpedHillsNoise),  -1.0f, 1.0f, 70.0f, 170.0f)),
+            std::make_unique<NoiseNode>(NG::c_WarpedOffsetXNoise),
+            std::make_unique<NoiseNode>(NG::c_WarpedOffsetZNoise),
+            40.0f));
+    }
+
+    struct RunResult {
+        double             Seconds = 0.0;
+        std::vector<float> Heights;
+    };
+
+    // fillChunk(originX, originZ, out) fills one chunk's grid.
+    template<typename FillChunk>
+    RunResult Run(const int chunkCount, FillChunk&& fillChunk) {
+        const int side = 1 + static_cast<int>(std::sqrt(static_cast<double>(chunkCount)));
+
+        RunResult result;
+        result.Heights.resize(static_cast<size_t>(chunkCount) * c_ChunkSamples);
+
+        const auto start = std::chrono::steady_clock::now();
+
+        for (int i = 0; i < chunkCount; ++i) {
+            const float originX = static_cast<float>((i % side) * static_cast<int>(c_ChunkSize));
+            const float originZ = static_cast<float>((i / side) * static_cast<int>(c_ChunkSize));
+
+            fillChunk(originX, originZ, std::span<float>(result.Heights.data() + static_cast<size_t>(i) * c_ChunkSamples, c_ChunkSamples));
+        }
+
+        result.Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return result;
+    }
+
+    float MaxDifference(const std::vector<float>& a, const std::vector<float>& b) {
+        float difference = 0.0f;
+
+        for (size_t i = 0; i < a.size(); ++i) {
+            difference = std::max(difference, std::abs(a[i] - b[i]));
+        }
+
+        return difference;
+    }
+
+    template<typename Graph>
+    void Compare(const char* name, const Node& interpreted, const int chunkCount) {
+        const double samples = static_cast<double>(chunkCount) * c_ChunkSamples;
+
+        const RunResult baseline = Run(chunkCount, [&interpreted](const float originX, const float originZ, const std::span<float> out) {
+            for (size_t x = 0; x < c_ChunkSize; ++x) {
+                for (size_t z = 0; z < c_ChunkSize; ++z) {
+                    out[x * c_ChunkSize + z] = interpreted.Eval(originX + static_cast<float>(x), originZ + static_cast<float>(z));
+                }
+            }
+        });
+
+        std::printf("\n%s, %d chunks\n", name, chunkCount);
+        std::printf("%-22s %10s %16s %10s %12s\n", "variant", "seconds", "samples/sec", "speedup", "max diff");
+        std::printf("%-22s %10.3f %16.0f %9.2fx %12s\n", "interpreted", baseline.Seconds, samples / baseline.Seconds, 1.0, "-");
+
+        constexpr std::array c_Levels{ Mct::SimdLevel::Scalar, Mct::SimdLevel::Sse41, Mct::SimdLevel::Avx2 };
+
+        for (const Mct::SimdLevel level : c_Levels) {
+            const Mct::FusedNoise<Graph> fused(c_Seed, level);
+
+            // Capped to what the CPU supports, the level already ran.
+            if (fused.GetSimdLevel() != level)
+                continue;
+
+            const RunResult result = Run(chunkCount, [&fused](const float originX, const float originZ, const std::span<float> out) {
+                fused.FillGrid(originX, originZ, c_ChunkSize, c_ChunkSize, 1.0f, out);
+            });
+
+            char variant[32];
+            std::snprintf(variant, sizeof(variant), "fused %s", Mct::ToString(level));
+
+            std::printf("%-22s %10.3f %16.0f %9.2fx %12.5f\n", variant, result.Seconds, samples / result.Seconds,
+                        baseline.Seconds / result.Seconds, MaxDifference(baseline.Heights, result.Heights));
+        }
+    }
+
+}
+
+
+int main(int argc, char** argv) {
+    int chunkCount = 1024;
+
+    if (argc > 1) {
+        chunkCount = std::max(1, std::atoi(argv[1]));
+    }
+
+    std::printf("Noise graphs: fused kernels vs runtime interpreted nodes, supported SIMD %s\n",
+                Mct::ToString(Mct::BatchedNoise::GetSupportedSimdLevel()));
+
+    Compare<NG::SimpleTerrainHeight>("SimpleTerrainHeight", *BuildSimpleHeight(), chunkCount);
+    Compare<NG::WarpedTerrainHeight>("WarpedTerrainHeight", *BuildWarpedHeight(), chunkCount);
+
+    return 0;
+}
@@ -0,0 +1,154 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+// Contention benchmark for the TaskProcessorPool queue backends.
+//
+// Floods a pool with many tiny tasks from several producer threads, once with single Submit calls
+// and once with SubmitBatch, and reports throughput for LockedTaskQueue and LockFreeTaskQueue.
+// A last LockFree run uses batches over the ring's capacity / producers, where the producers fill
+// the ring between them before any batch is done, it hangs if a batch keeps its wakeups back.
+//
+// Usage: TaskPoolContentionBenchmark [taskCount] [workerCount] [producerCount] [batchSize]
+//        Defaults to 2'000'000 tasks, 6 workers, 4 producers, batches of 64.
+
+
+#include "Utils/TaskProcessorPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+
+namespace {
+
+    constexpr size_t c_LockFreeCapacity = 4096;
+
+    struct Counters {
+        std::atomic<uint64_t> Sum{ 0 };
+        std::atomic<size_t>   Remaining{ 0 };
+    };
+
+    // Roughly the cost of pushing a small result, so the queue dominates the profile.
+    struct TinyTask {
+        uint32_t Value;
+    };
+
+    class TinyTaskFunctor {
+    public:
+        explicit TinyTaskFunctor(Counters* counters) : m_Counters(counters) {}
+
+        void operator()(TinyTask task) {
+            m_Counters->Sum.fetch_add(task.Value, std::memory_order_relaxed);
+
+            if (m_Counters->Remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                m_Counters->Remaining.notify_all();
+            }
+        }
+
+    private:
+        Counters* m_Counters;
+    };
+
+    struct BenchConfig {
+        size_t TaskCount     = 2'000'000;
+        size_t WorkerCount   = 6;
+        size_t ProducerCount = 4;
+        size_t BatchSize     = 64;
+    };
+
+    template<typename Queue_T>
+    double Run(const BenchConfig& config, const bool batched) {
+        Counters counters;
+        counters.Remaining.store(config.TaskCount);
+
+        using Pool_T = Mct::TaskProcessorPool<TinyTask, TinyTaskFunctor, Queue_T>;
+        Pool_T pool(config.WorkerCount, TinyTaskFunctor(&counters));
+
+        const size_t perProducer = config.TaskCount / config.ProducerCount;
+
+        const auto start = std::chrono::steady_clock::now();
+
+        std::vector<std::thread> producers;
+        for (size_t p = 0; p < config.ProducerCount; ++p) {
+            const size_t count = (p + 1 == config.ProducerCount)
+                               ? config.TaskCount - perProducer * p
+                               : perProducer;
+
+            producers.emplace_back([&pool, &config, count, batched] {
+                if (!batched) {
+                    for (size_t i = 0; i < count; ++i) {
+                        pool.Submit(TinyTask{ static_cast<uint32_t>(i & 0xFF) });
+                    }
+
+                    return;
+                }
+
+                std::vector<TinyTask> batch;
+                batch.reserve(config.BatchSize);
+
+                for (size_t i = 0; i < count; ++i) {
+                    batch.push_back(TinyTask{ static_cast<uint32_t>(i & 0xFF) });
+
+                    if (batch.size() == config.BatchSize) {
+                        pool.SubmitBatch(std::move(batch));
+                        batch.clear();
+                    }
+                }
+
+                pool.SubmitBatch(std::move(batch));
+            });
+        }
+
+        for (std::thread& producer : producers) {
+            producer.join();
+        }
+
+        for (size_t remaining = counters.Remaining.load(); remaining != 0; remaining = counters.Remaining.load()) {
+            counters.Remaining.wait(remaining);
+        }
+
+        const auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(end - start).count();
+    }
+
+    void Report(const char* name, const BenchConfig& config, const double seconds) {
+        std::printf("%-28s %10.3f s %12.2f Mtasks/s\n", name, seconds, config.TaskCount / seconds / 1e6);
+    }
+
+}
+
+
+int main(int argc, char** argv) {
+    BenchConfig config;
+
+    if (argc > 1) config.TaskCount     = std::max<long long>(1, std::atoll(argv[1]));
+    if (argc > 2) config.WorkerCount   = std::max<long long>(1, std::atoll(argv[2]));
+    if (argc > 3) config.ProducerCount = std::max<long long>(1, std::atoll(argv[3]));
+    if (argc > 4) config.BatchSize     = std::max<long long>(1, std::atoll(argv[4]));
+
+    std::printf("TaskProcessorPool contention: %zu tasks, %zu workers, %zu producers, batch %zu\n",
+                config.TaskCount, config.WorkerCount, config.ProducerCount, config.BatchSize);
+
+    using Locked_T   = Mct::LockedTaskQueue<TinyTask>;
+    using LockFree_T = Mct::LockFreeTaskQueue<TinyTask, c_LockFreeCapacity>;
+
+    Report("Locked   / Submit",      config, Run<Locked_T>(config,   false));
+    Report("LockFree / Submit",      config, Run<LockFree_T>(config, false));
+    Report("Locked   / SubmitBatch", config, Run<Locked_T>(config,   true));
+    Report("LockFree / SubmitBatch", config, Run<LockFree_T>(config, true));
+
+    BenchConfig oversized = config;
+    oversized.BatchSize   = std::max(config.BatchSize, 2 * c_LockFreeCapacity / config.ProducerCount + 1);
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "LockFree / batch %zu", oversized.BatchSize);
+    Report(name, oversized, Run<LockFree_T>(oversized, true));
+
+    return 0;
+}
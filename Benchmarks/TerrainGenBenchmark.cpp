@@ -0,0 +1,601 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+// Measures every TerrainGenerator variant outside the game loop.
+//
+// Each TerrainType generates the same fixed sets of chunks, one region tile per GenerateRegion call
+// like the ChunkManager, first on one thread and then on --threads threads pulling the tiles from a
+// shared counter. Every run gets a fresh generator, so caches such as BiomeTerrainGen's climate
+// tiles start cold, and is repeated with the fastest repetition kept. The chunks are allocated
+// before the clock starts.
+//
+// Per run it reports chunks per second, nanoseconds per block, the heap allocations made while
+// generating (this executable replaces the global operator new to count them) and, where
+// perf_event_open is available and allowed, the hardware cache references and misses.
+//
+// --json writes the results, --baseline reads such a file back and compares the throughput of every
+// run in it, exiting with 1 when one lost more than --tolerance (a fraction, 0.1 by default). The
+// file records the seed, tiles, noise kernels and build type, a baseline taken with any of them
+// different fails the comparison instead of comparing unrelated numbers. Only compare results
+// taken on the same machine.
+//
+// Benchmarks/Baselines/TerrainGenBenchmark.json is the reference baseline, taken with the defaults
+// on a single core x86-64 machine with AVX2, GCC 12 at -O2 with the Release defines. Refresh it
+// from the repository root on the machine comparing against it, after a change meant to move the
+// numbers:
+//     TerrainGenBenchmark --json Benchmarks/Baselines/TerrainGenBenchmark.json
+//
+// Usage: TerrainGenBenchmark [--terrain flat|simple|warped|biome|density] [--tiles N] [--threads N]
+//                            [--repeat N] [--seed N] [--json path] [--baseline path] [--tolerance F]
+//        Defaults to every terrain, 4 x 4 region tiles per coordinate set, the JobSystem's default
+//        worker count, 3 repetitions and WorldSettings' seed.
+//        Run from the repository root so Assets/ is found.
+
+
+#include "World/Chunk/Chunk.h"
+#include "World/Block/BlockDataManager.h"
+#include "World/Biome/BiomeDataManager.h"
+#include "World/TerrainGeneration/TerrainGenerator.h"
+#include "World/TerrainGeneration/Noise/BatchedNoise.h"
+#include "Utils/JobSystem.h"
+#include "Utils/Logger.h"
+
+#include <yaml-cpp/yaml.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <new>
+#include <optional>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#if defined(__linux__)
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+
+namespace {
+
+    // Every allocation of the process, read before and after the timed part of a run.
+    std::atomic<uint64_t> g_AllocationCount{ 0 };
+    std::atomic<uint64_t> g_AllocatedBytes{ 0 };
+
+}
+
+
+void* operator new(const size_t size) {
+    g_AllocationCount.fetch_add(1, std::memory_order_relaxed);
+    g_AllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+    if (void* memory = std::malloc(size > 0 ? size : 1))
+        return memory;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept {
+    std::free(memory);
+}
+
+
+namespace {
+
+    using Clock_T = std::chrono::steady_clock;
+
+#if defined(MCT_DEBUG)
+    constexpr const char* c_BuildType = "Debug";
+#elif defined(MCT_RELEASE)
+    constexpr const char* c_BuildType = "Release";
+#else
+    constexpr const char* c_BuildType = "Other";
+#endif
+
+    constexpr uint64_t c_BlocksPerChunk = Mct::WorldConst::ChunkSizeX * Mct::WorldConst::ChunkSizeY * Mct::WorldConst::ChunkSizeZ;
+
+    struct TerrainName {
+        const char*      Name;
+        Mct::TerrainType Type;
+    };
+
+    constexpr TerrainName c_TerrainNames[] = {
+        { "flat",    Mct::TerrainType::SuperFlat },
+        { "simple",  Mct::TerrainType::Simple    },
+        { "warped",  Mct::TerrainType::Warped    },
+        { "biome",   Mct::TerrainType::Biome     },
+        { "density", Mct::TerrainType::Density   }
+    };
+
+    // Region aligned origins, far from the spawn the noise inputs get large.
+    struct CoordSet {
+        const char*     Name;
+        Mct::ChunkCoord Origin;
+    };
+
+    constexpr CoordSet c_CoordSets[] = {
+        { "spawn", { .X = 0,     .Z = 0      } },
+        { "far",   { .X = 40000, .Z = -25000 } }
+    };
+
+    struct Options {
+        std::optional<Mct::TerrainType> Terrain;
+        int                             Tiles       = 4;
+        size_t                          ThreadCount = Mct::JobSystem::GetDefaultWorkerCount();
+        int                             Repeat      = 3;
+        int32_t                         Seed        = Mct::WorldSettings{}.Seed;
+        double                          Tolerance   = 0.1;
+        std::string                     JsonPath;
+        std::string                     BaselinePath;
+    };
+
+    struct RunResult {
+        const char* Terrain        = "";
+        const char* Set            = "";
+        size_t      Threads        = 1;
+        size_t      Chunks         = 0;
+        double      Seconds        = 0.0;
+        uint64_t    Allocations    = 0;
+        uint64_t    AllocatedBytes = 0;
+
+        std::optional<uint64_t> CacheReferences;
+        std::optional<uint64_t> CacheMisses;
+
+        [[nodiscard]] double GetChunksPerSecond() const noexcept { return static_cast<double>(Chunks) / Seconds; }
+        [[nodiscard]] double GetNsPerBlock()      const noexcept { return Seconds * 1e9 / static_cast<double>(Chunks * c_BlocksPerChunk); }
+    };
+
+    // Hardware cache references and misses of the process and the threads it starts while counting.
+    // Unavailable off Linux, in most containers and VMs, or when perf_event_paranoid forbids it.
+    class CacheCounters {
+    public:
+        CacheCounters() {
+#if defined(__linux__)
+            m_References = Open(PERF_COUNT_HW_CACHE_REFERENCES);
+            m_Misses     = Open(PERF_COUNT_HW_CACHE_MISSES);
+
+            if (m_References < 0 || m_Misses < 0) {
+                Close();
+            }
+#endif
+        }
+
+        ~CacheCounters() { Close(); }
+
+        CacheCounters(const CacheCounters&)            = delete;
+        CacheCounters& operator=(const CacheCounters&) = delete;
+
+        [[nodiscard]] bool IsAvailable() const noexcept { return m_References >= 0; }
+
+        void Start() noexcept {
+#if defined(__linux__)
+            for (const int fd : { m_References, m_Misses }) {
+                if (fd >= 0) {
+                    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+                }
+            }
+#endif
+        }
+
+        // The counts since Start, the threads started in between have to be joined.
+        void Stop(RunResult& outResult) noexcept {
+#if defined(__linux__)
+            if (!IsAvailable())
+                return;
+
+            ioctl(m_References, PERF_EVENT_IOC_DISABLE, 0);
+            ioctl(m_Misses,     PERF_EVENT_IOC_DISABLE, 0);
+
+            outResult.CacheReferences = Read(m_References);
+            outResult.CacheMisses     = Read(m_Misses);
+#else
+            (void)outResult;
+#endif
+        }
+
+    private:
+#if defined(__linux__)
+        static int Open(const uint64_t config) noexcept {
+            perf_event_attr attr{};
+            attr.type           = PERF_TYPE_HARDWARE;
+            attr.size           = sizeof(attr);
+            attr.config         = config;
+            attr.disabled       = 1;
+            attr.inherit        = 1;    // Also counts the worker threads.
+            attr.exclude_kernel = 1;
+            attr.exclude_hv     = 1;
+
+            return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+        }
+
+        static std::optional<uint64_t> Read(const int fd) noexcept {
+            uint64_t value = 0;
+
+            if (read(fd, &value, sizeof(value)) != static_cast<ssize_t>(sizeof(value)))
+                return std::nullopt;
+
+            return value;
+        }
+#endif
+
+        void Close() noexcept {
+#if defined(__linux__)
+            for (int* fd : { &m_References, &m_Misses }) {
+                if (*fd >= 0) {
+                    close(*fd);
+                }
+
+                *fd = -1;
+            }
+#endif
+        }
+
+    private:
+        int m_References = -1;
+        int m_Misses     = -1;
+    };
+
+    // Generates tiles x tiles region tiles from set.Origin with a fresh generator.
+    RunResult RunOnce(const Options& options, const TerrainName& terrain, const CoordSet& set, const size_t threadCount,
+                      CacheCounters& counters) {
+        constexpr int regionSize = Mct::TerrainGenerator::c_RegionSize;
+
+        Mct::TerrainGenerator generator = Mct::TerrainGenerator::Create(terrain.Type, options.Seed);
+
+        std::vector<std::unique_ptr<Mct::Chunk>> chunks;
+        std::vector<std::vector<Mct::Chunk*>>    regions;
+
+        for (int tileX = 0; tileX < options.Tiles; ++tileX) {
+            for (int tileZ = 0; tileZ < options.Tiles; ++tileZ) {
+                std::vector<Mct::Chunk*>& region = regions.emplace_back();
+
+                for (int x = 0; x < regionSize; ++x) {
+                    for (int z = 0; z < regionSize; ++z) {
+                        const Mct::ChunkCoord coord{
+                            .X = set.Origin.X + tileX * regionSize + x,
+                            .Z = set.Origin.Z + tileZ * regionSize + z
+                        };
+
+                        region.push_back(chunks.emplace_back(std::make_unique<Mct::Chunk>(coord)).get());
+                    }
+                }
+            }
+        }
+
+        std::atomic<size_t> nextRegion{ 0 };
+
+        const auto generateRegions = [&generator, &regions, &nextRegion] {
+            for (size_t i = nextRegion.fetch_add(1); i < regions.size(); i = nextRegion.fetch_add(1)) {
+                generator.GenerateRegion(regions[i]);
+            }
+        };
+
+        RunResult result{
+            .Terrain = terrain.Name,
+            .Set     = set.Name,
+            .Threads = threadCount,
+            .Chunks  = chunks.size()
+        };
+
+        const uint64_t allocationsBefore = g_AllocationCount.load();
+        const uint64_t bytesBefore       = g_AllocatedBytes.load();
+
+        counters.Start();
+        const auto start = Clock_T::now();
+
+        if (threadCount == 1) {
+            generateRegions();
+        }
+        else {
+            std::vector<std::thread> threads;
+            threads.reserve(threadCount);
+
+            for (size_t i = 0; i < threadCount; ++i) {
+                threads.emplace_back(generateRegions);
+            }
+
+            for (std::thread& thread : threads) {
+                thread.join();
+            }
+        }
+
+        result.Seconds = std::chrono::duration<double>(Clock_T::now() - start).count();
+        counters.Stop(result);
+
+        // The thread objects' own allocations are counted too, a handful against thousands of chunks.
+        result.Allocations    = g_AllocationCount.load() - allocationsBefore;
+        result.AllocatedBytes = g_AllocatedBytes.load()  - bytesBefore;
+
+        return result;
+    }
+
+    RunResult Run(const Options& options, const TerrainName& terrain, const CoordSet& set, const size_t threadCount,
+                  CacheCounters& counters) {
+        RunResult best = RunOnce(options, terrain, set, threadCount, counters);
+
+        for (int i = 1; i < options.Repeat; ++i) {
+            RunResult result = RunOnce(options, terrain, set, threadCount, counters);
+
+            if (result.Seconds < best.Seconds) {
+                best = result;
+            }
+        }
+
+        return best;
+    }
+
+    void PrintHeader() {
+        std::printf("%-8s %-6s %7s %12s %10s %10s %10s %12s %12s %7s\n", "terrain", "set", "threads", "chunks/s", "ns/block",
+                    "allocs", "alloc MiB", "cache refs", "cache miss", "miss %");
+    }
+
+    void PrintResult(const RunResult& result) {
+        std::printf("%-8s %-6s %7zu %12.1f %10.3f %10llu %10.2f ", result.Terrain, result.Set, result.Threads,
+                    result.GetChunksPerSecond(), result.GetNsPerBlock(), static_cast<unsigned long long>(result.Allocations),
+                    static_cast<double>(result.AllocatedBytes) / (1024.0 * 1024.0));
+
+        if (result.CacheReferences && result.CacheMisses) {
+            const double missRate = *result.CacheReferences > 0 ? 100.0 * static_cast<double>(*result.CacheMisses) / static_cast<double>(*result.CacheReferences) : 0.0;
+
+            std::printf("%12llu %12llu %6.1f%%\n", static_cast<unsigned long long>(*result.CacheReferences),
+                        static_cast<unsigned long long>(*result.CacheMisses), missRate);
+        }
+        else {
+            std::printf("%12s %12s %7s\n", "-", "-", "-");
+        }
+    }
+
+    void WriteCount(std::ofstream& file, const char* name, const std::optional<uint64_t>& value) {
+        file << ", \"" << name << "\": ";
+
+        if (value) {
+            file << *value;
+        }
+        else {
+            file << "null";
+        }
+    }
+
+    // One result object per line, so baselines diff well.
+    bool WriteJson(const Options& options, const std::vector<RunResult>& results) {
+        std::ofstream file(options.JsonPath, std::ios::trunc);
+
+        if (!file) {
+            std::fprintf(stderr, "Failed to open %s for writing\n", options.JsonPath.c_str());
+            return false;
+        }
+
+        file << "{\n";
+        file << "  \"seed\": " << options.Seed << ",\n";
+        file << "  \"tiles\": " << options.Tiles << ",\n";
+        file << "  \"simd\": \"" << Mct::ToString(Mct::BatchedNoise::GetSupportedSimdLevel()) << "\",\n";
+        file << "  \"build\": \"" << c_BuildType << "\",\n";
+        file << "  \"results\": [\n";
+
+        for (size_t i = 0; i < results.size(); ++i) {
+            const RunResult& result = results[i];
+
+            file << "    { \"terrain\": \"" << result.Terrain << "\", \"set\": \"" << result.Set << "\""
+                 << ", \"threads\": " << result.Threads
+                 << ", \"chunks\": " << result.Chunks
+                 << ", \"seconds\": " << result.Seconds
+                 << ", \"chunksPerSecond\": " << result.GetChunksPerSecond()
+                 << ", \"nsPerBlock\": " << result.GetNsPerBlock()
+                 << ", \"allocations\": " << result.Allocations
+                 << ", \"allocatedBytes\": " << result.AllocatedBytes;
+
+            WriteCount(file, "cacheReferences", result.CacheReferences);
+            WriteCount(file, "cacheMisses",     result.CacheMisses);
+
+            file << " }" << (i + 1 < results.size() ? "," : "") << "\n";
+        }
+
+        file << "  ]\n";
+        file << "}\n";
+
+        std::printf("\nWrote %zu results to %s\n", results.size(), options.JsonPath.c_str());
+        return true;
+    }
+
+    struct BaselineEntry {
+        double   ChunksPerSecond = 0.0;
+        uint64_t Allocations     = 0;
+    };
+
+    using BaselineKey_T = std::tuple<std::string, std::string, size_t>;   // Terrain, set, threads.
+
+    // Every run of the baseline also measured now is compared, a throughput loss over the tolerance
+    // fails. Returns false on regressions or an unreadable baseline.
+    bool CompareBaseline(const Options& options, const std::vector<RunResult>& results) {
+        std::map<BaselineKey_T, BaselineEntry> baseline;
+
+        // JSON is a subset of YAML, yaml-cpp reads it back.
+        try {
+            const YAML::Node root = YAML::LoadFile(options.BaselinePath);
+
+            const int32_t     seed  = root["seed"].as<int32_t>();
+            const int         tiles = root["tiles"].as<int>();
+            const std::string simd  = root["simd"].as<std::string>();
+            const std::string build = root["build"].as<std::string>();
+
+            const char* const currentSimd = Mct::ToString(Mct::BatchedNoise::GetSupportedSimdLevel());
+
+            // Different chunks or kernels, the throughput isn't comparable.
+            if (seed != options.Seed || tiles != options.Tiles || simd != currentSimd || build != c_BuildType) {
+                std::fprintf(stderr, "Baseline %s was taken with seed %d, %d tiles, %s noise and a %s build, "
+                                     "the runs use seed %d, %d tiles, %s noise and a %s build\n",
+                             options.BaselinePath.c_str(), seed, tiles, simd.c_str(), build.c_str(),
+                             options.Seed, options.Tiles, currentSimd, c_BuildType);
+                return false;
+            }
+
+            for (const YAML::Node& entry : root["results"]) {
+                baseline[{ entry["terrain"].as<std::string>(), entry["set"].as<std::string>(), entry["threads"].as<size_t>() }] = BaselineEntry{
+                    .ChunksPerSecond = entry["chunksPerSecond"].as<double>(),
+                    .Allocations     = entry["allocations"].as<uint64_t>()
+                };
+            }
+        }
+        catch (const YAML::Exception& e) {
+            std::fprintf(stderr, "Failed to read baseline %s: %s\n", options.BaselinePath.c_str(), e.what());
+            return false;
+        }
+
+        std::printf("\nAgainst baseline %s, %.0f%% tolerance\n", options.BaselinePath.c_str(), 100.0 * options.Tolerance);
+        std::printf("%-8s %-6s %7s %12s %12s %8s %12s\n", "terrain", "set", "threads", "base ch/s", "now ch/s", "change", "allocs");
+
+        size_t compared    = 0;
+        size_t regressions = 0;
+
+        for (const RunResult& result : results) {
+            const auto found = baseline.find({ result.Terrain, result.Set, result.Threads });
+
+            if (found == baseline.end())
+                continue;
+
+            const BaselineEntry& base   = found->second;
+            const double         change = result.GetChunksPerSecond() / base.ChunksPerSecond - 1.0;
+            const bool           slower = change < -options.Tolerance;
+
+            std::printf("%-8s %-6s %7zu %12.1f %12.1f %+7.1f%% %+12lld%s\n", result.Terrain, result.Set, result.Threads,
+                        base.ChunksPerSecond, result.GetChunksPerSecond(), 100.0 * change,
+                        static_cast<long long>(result.Allocations) - static_cast<long long>(base.Allocations),
+                        slower ? "  REGRESSION" : "");
+
+            ++compared;
+            regressions += slower;
+        }
+
+        if (compared == 0) {
+            std::printf("No run matches the baseline\n");
+            return false;
+        }
+
+        std::printf("%zu of %zu runs regressed\n", regressions, compared);
+        return regressions == 0;
+    }
+
+    bool ParseTerrain(const char* name, std::optional<Mct::TerrainType>& outTerrain) {
+        for (const TerrainName& terrain : c_TerrainNames) {
+            if (std::strcmp(name, terrain.Name) == 0) {
+                outTerrain = terrain.Type;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool ParseOptions(int argc, char** argv, Options& options) {
+        for (int i = 1; i < argc; ++i) {
+            if (std::strcmp(argv[i], "--tiles") == 0 && i + 1 < argc) {
+                options.Tiles = std::max(1, std::atoi(argv[++i]));
+            }
+            else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+                options.ThreadCount = static_cast<size_t>(std::max(1, std::atoi(argv[++i])));
+            }
+            else if (std::strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+                options.Repeat = std::max(1, std::atoi(argv[++i]));
+            }
+            else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+                options.Seed = static_cast<int32_t>(std::strtol(argv[++i], nullptr, 10));
+            }
+            else if (std::strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc) {
+                options.Tolerance = std::max(0.0, std::atof(argv[++i]));
+            }
+            else if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+                options.JsonPath = argv[++i];
+            }
+            else if (std::strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) {
+                options.BaselinePath = argv[++i];
+            }
+            else if (std::strcmp(argv[i], "--terrain") == 0 && i + 1 < argc && ParseTerrain(argv[i + 1], options.Terrain)) {
+                ++i;
+            }
+            else {
+                std::fprintf(stderr, "Usage: TerrainGenBenchmark [--terrain flat|simple|warped|biome|density] [--tiles N] [--threads N]\n"
+                                     "                           [--repeat N] [--seed N] [--json path] [--baseline path] [--tolerance F]\n");
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+}
+
+
+int main(int argc, char** argv) {
+    Options options;
+
+    if (!ParseOptions(argc, argv, options))
+        return 1;
+
+    Mct::Log::Init();
+
+    Mct::BlockDataManager::Init();
+    Mct::BiomeDataManager::Init();
+
+    CacheCounters counters;
+
+    const int regionSize = Mct::TerrainGenerator::c_RegionSize;
+
+    std::printf("Terrain generators: %d x %d chunks per set, seed %d, %s noise, best of %d, cache counters %s\n\n",
+                options.Tiles * regionSize, options.Tiles * regionSize, options.Seed,
+                Mct::ToString(Mct::BatchedNoise::GetSupportedSimdLevel()), options.Repeat,
+                counters.IsAvailable() ? "on" : "unavailable");
+
+    PrintHeader();
+
+    // Single threaded, then across the threads unless that's one as well.
+    std::vector<size_t> threadCounts{ 1 };
+
+    if (options.ThreadCount > 1) {
+        threadCounts.push_back(options.ThreadCount);
+    }
+
+    std::vector<RunResult> results;
+
+    for (const TerrainName& terrain : c_TerrainNames) {
+        if (options.Terrain && *options.Terrain != terrain.Type)
+            continue;
+
+        for (const CoordSet& set : c_CoordSets) {
+            for (const size_t threadCount : threadCounts) {
+                results.push_back(Run(options, terrain, set, threadCount, counters));
+                PrintResult(results.back());
+            }
+        }
+    }
+
+    int result = 0;
+
+    if (!options.JsonPath.empty() && !WriteJson(options, results)) {
+        result = 1;
+    }
+
+    if (!options.BaselinePath.empty() && !CompareBaseline(options, results)) {
+        result = 1;
+    }
+
+    Mct::Log::Shutdown();
+
+    return result;
+}
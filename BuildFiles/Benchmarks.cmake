@@ -0,0 +1,76 @@
+# SPDX-License-Identifier: MIT
+# Copyright (c) 2025 Jayantkumar56
+
+
+# Standalone benchmark executables, they don't need a window or a GL context.
+option(MCT_BUILD_BENCHMARKS "Build the benchmark executables in Benchmarks/" OFF)
+
+if(NOT MCT_BUILD_BENCHMARKS)
+    return()
+endif()
+
+
+set(BENCHMARK_SOURCE_DIRECTORY "${CMAKE_CURRENT_SOURCE_DIR}/Benchmarks")
+
+
+# JobSystem worker scaling
+add_executable(JobSystemBenchmark
+    "${BENCHMARK_SOURCE_DIRECTORY}/JobSystemBenchmark.cpp"
+    "${BASE_SOURCE_DIRECTORY}/Utils/JobSystem.h"
+    "${BASE_SOURCE_DIRECTORY}/Utils/JobSystem.cpp"
+    "${BASE_SOURCE_DIRECTORY}/Utils/WorkerPoolMetrics.h"
+    "${BASE_SOURCE_DIRECTORY}/Utils/WorkerPoolMetrics.cpp"
+)
+
+target_include_directories(JobSystemBenchmark PRIVATE "Src")
+target_link_libraries(JobSystemBenchmark PRIVATE FastNoiseLite spdlog)
+
+enable_release_optimizations_for(JobSystemBenchmark)
+add_compiler_flags_for(JobSystemBenchmark)
+
+set_target_properties(JobSystemBenchmark PROPERTIES FOLDER "Benchmarks")
+
+
+# TaskProcessorPool queue backend contention
+add_executable(TaskPoolContentionBenchmark
+    "${BENCHMARK_SOURCE_DIRECTORY}/TaskPoolContentionBenchmark.cpp"
+    "${BASE_SOURCE_DIRECTORY}/Utils/MpmcQueue.h"
+    "${BASE_SOURCE_DIRECTORY}/Utils/TaskQueues.h"
+    "${BASE_SOURCE_DIRECTORY}/Utils/TaskProcessorPool.h"
+    "${BASE_SOURCE_DIRECTORY}/Utils/WorkerPoolMetrics.h"
+    "${BASE_SOURCE_DIRECTORY}/Utils/WorkerPoolMetrics.cpp"
+)
+
+target_include_directories(TaskPoolContentionBenchmark PRIVATE "Src")
+target_link_libraries(TaskPoolContentionBenchmark PRIVATE spdlog)
+
+enable_release_optimizations_for(TaskPoolContentionBenchmark)
+add_compiler_flags_for(TaskPoolContentionBenchmark)
+
+set_target_properties(TaskPoolContentionBenchmark PROPERTIES FOLDER "Benchmarks")
+
+
+# Fused noise graph kernels against the same graphs interpreted at runtime
+add_executable(NoiseGraphBenchmark
+    "${BENCHMARK_SOURCE_DIRECTORY}/NoiseGraphBenchmark.cpp"
+)
+
+target_link_libraries(NoiseGraphBenchmark PRIVATE ${WORLD_LIB_NAME})
+
+enable_release_optimizations_for(NoiseGraphBenchmark)
+add_compiler_flags_for(NoiseGraphBenchmark)
+
+set_target_properties(NoiseGraphBenchmark PROPERTIES FOLDER "Benchmarks")
+
+
+# Every TerrainGenerator variant over fixed chunk sets, single and multi threaded
+add_executable(TerrainGenBenchmark
+    "${BENCHMARK_SOURCE_DIRECTORY}/TerrainGenBenchmark.cpp"
+)
+
+target_link_libraries(TerrainGenBenchmark PRIVATE ${WORLD_LIB_NAME})
+
+enable_release_optimizations_for(TerrainGenBenchmark)
+add_compiler_flags_for(TerrainGenBenchmark)
+
+set_target_properties(TerrainGenBenchmark PROPERTIES FOLDER "Benchmarks")
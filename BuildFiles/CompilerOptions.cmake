@@ -48,3 +48,42 @@ function(add_compiler_flags_for TARGET)
         set_target_properties(${TARGET} PROPERTIES POSITION_INDEPENDENT_CODE ON)
     endif()
 endfunction()
+
+
+# compile the given sources for a wider instruction set (SSE41 or AVX2) than the rest of the project
+# the code in them must only run after checking at runtime that the cpu supports it
+function(enable_instruction_set_for_sources INSTRUCTION_SET)
+    if(NOT CMAKE_SYSTEM_PROCESSOR MATCHES "x86_64|AMD64|amd64|x86|i[3-6]86")
+        return()
+    endif()
+
+    set(ISA_FLAGS "")
+
+    if(CMAKE_CXX_COMPILER_ID STREQUAL "MSVC")
+        if(INSTRUCTION_SET STREQUAL "AVX2")
+            set(ISA_FLAGS /arch:AVX2)                   # sse4.1 intrinsics need no flag on msvc
+        endif()
+    elseif(CMAKE_CXX_COMPILER_ID MATCHES "Clang|GNU")
+        if(INSTRUCTION_SET STREQUAL "SSE41")
+            set(ISA_FLAGS -msse4.1)
+        elseif(INSTRUCTION_SET STREQUAL "AVX2")
+            set(ISA_FLAGS -mavx2)
+        endif()
+    endif()
+
+    if(ISA_FLAGS)
+        set_property(SOURCE ${ARGN} APPEND PROPERTY COMPILE_OPTIONS ${ISA_FLAGS})
+    endif()
+endfunction()
+
+
+# compile the given sources with strict ieee float math even in release, overriding the fast math
+# of enable_release_optimizations_for (source options come after the target's on the command line)
+# code whose results must match bit for bit between its scalar and simd variants lives in them
+function(enable_precise_float_for_sources)
+    if(CMAKE_CXX_COMPILER_ID STREQUAL "MSVC")
+        set_property(SOURCE ${ARGN} APPEND PROPERTY COMPILE_OPTIONS /fp:precise)
+    elseif(CMAKE_CXX_COMPILER_ID MATCHES "Clang|GNU")
+        set_property(SOURCE ${ARGN} APPEND PROPERTY COMPILE_OPTIONS -fno-fast-math -ffp-contract=off)
+    endif()
+endfunction()
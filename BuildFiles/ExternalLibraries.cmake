@@ -28,11 +28,8 @@ add_subdirectory( Vendor/QkTraits      )
 include("BuildFiles/imgui.cmake")
 include("BuildFiles/tracy.cmake")
 
-target_link_libraries(${CURRENT_PROJ_NAME} PRIVATE 
-    glfw 
-    Glad
+target_link_libraries(${WORLD_LIB_NAME} PUBLIC
     glm
-    imgui
     stb
     yaml-cpp
     FastNoiseLite
@@ -41,6 +38,13 @@ target_link_libraries(${CURRENT_PROJ_NAME} PRIVATE
     QkTraits
 )
 
+target_link_libraries(${CURRENT_PROJ_NAME} PRIVATE 
+    ${WORLD_LIB_NAME}
+    glfw 
+    Glad
+    imgui
+)
+
 set_target_properties(
     Glad 
     glm
@@ -20,6 +20,9 @@ endfunction(RegisterSourceFiles)
 
 set(BASE_SOURCE_DIRECTORY "${CMAKE_CURRENT_SOURCE_DIR}/Src")
 
+# SOURCE_FILES make up the game executable. WORLD_SOURCE_FILES make up the world library shared
+# with the headless tools, they must build without GLFW, Glad, ImGui or a GL context.
+
 # Source files in Application
 RegisterSourceFiles(SOURCE_FILES "${BASE_SOURCE_DIRECTORY}/Application"
     "Application.h"
@@ -64,7 +67,7 @@ RegisterSourceFiles(SOURCE_FILES "${BASE_SOURCE_DIRECTORY}/Renderer/Camera"
 )
 
 # Source files in Renderer/Mesh
-RegisterSourceFiles(SOURCE_FILES "${BASE_SOURCE_DIRECTORY}/Renderer/Mesh"
+RegisterSourceFiles(WORLD_SOURCE_FILES "${BASE_SOURCE_DIRECTORY}/Renderer/Mesh"
     "GpuMeshHandle.h"
     "GpuMeshHandle.cpp"
     "Mesh.h"
@@ -104,6 +107,8 @@ RegisterSourceFiles(SOURCE_FILES "${BASE_SOURCE_DIRECTORY}/Renderer"
     "GameRenderer.cpp"
     "MeshManager.h"
     "MeshManager.cpp"
+    "Sky.h"
+    "Sky.cpp"
     "SkyboxRenderer.h"
     "SkyboxRenderer.cpp"
     "WorldRenderer.h"
@@ -111,35 +116,47 @@ RegisterSourceFiles(SOURCE_FILES "${BASE_SOURCE_DIRECTORY}/Renderer"
 )
 
 # Source files in Utils
-RegisterSourceFiles(SOURCE_FILES "${BASE_SOURCE_DIRECTORY}/Utils"
+RegisterSourceFiles(WORLD_SOURCE_FILES "${BASE_SOURCE_DIRECTORY}/Utils"
     "Assert.h"
     "BuddyAllocator.h"
     "BuddyAllocator.cpp"
+    "CacheLine.h"
+    "Coroutine.h"
     "CubeData.h"
+    "DeferredReclaimer.h"
+    "DeferredReclaimer.cpp"
+    "EpochReclaimer.h"
+    "EpochReclaimer.cpp"
     "FileUtils.h"
     "IdGenerator.h"
     "Image.h"
     "Image.cpp"
+    "JobSystem.h"
+    "JobSystem.cpp"
     "Logger.h"
     "Logger.cpp"
     "Math.h"
+    "MpmcQueue.h"
+    "MpscChannel.h"
     "NonCopyable.h"
     "NonMovable.h"
     "Profiler.h"
     "TaskProcessorPool.h"
+    "TaskQueues.h"
     "TextureUtils.h"
-    "ThreadSafeVector.h"
+    "WorkerPoolMetrics.h"
+    "WorkerPoolMetrics.cpp"
 )
 
 # Source files in World/Biome
-RegisterSourceFiles(SOURCE_FILES "${BASE_SOURCE_DIRECTORY}/World/Biome"
+RegisterSourceFiles(WORLD_SOURCE_FILES "${BASE_SOURCE_DIRECTORY}/World/Biome"
     "Biome.h"
     "BiomeDataManager.h"
     "BiomeDataManager.cpp"
 )
 
 # Source files in World/Block
-RegisterSourceFiles(SOURCE_FILES "${BASE_SOURCE_DIRECTORY}/World/Block"
+RegisterSourceFiles(WORLD_SOURCE_FILES "${BASE_SOURCE_DIRECTORY}/World/Block"
     "Block.h"
     "BlockDataManager.h"
     "BlockDataManager.cpp"
@@ -147,35 +164,91 @@ RegisterSourceFiles(SOURCE_FILES "${BASE_SOURCE_DIRECTORY}/World/Block"
 )
 
 # Source files in World/Chunk
-RegisterSourceFiles(SOURCE_FILES "${BASE_SOURCE_DIRECTORY}/World/Chunk"
+RegisterSourceFiles(WORLD_SOURCE_FILES "${BASE_SOURCE_DIRECTORY}/World/Chunk"
     "BlockStorage.h"
     "Chunk.h"
     "ChunkCoord.h"
     "ChunkGpuMesh.h"
+    "ChunkHeightmaps.h"
+    "ChunkHeightmaps.cpp"
     "ChunkMesh.h"
     "ChunkMeshGenerator.h"
     "ChunkMeshGenerator.cpp"
     "ChunkNeighbor.h"
     "ChunkSpan.h"
+    "ChunkTimeline.h"
+    "CompressedBlocks.h"
+    "CompressedBlocks.cpp"
     "PackedTerrainMesh.h"
     "Subchunk.h"
+    "TreeAnchor.h"
+)
+
+# Source files in World/TerrainGeneration/Noise
+RegisterSourceFiles(WORLD_SOURCE_FILES "${BASE_SOURCE_DIRECTORY}/World/TerrainGeneration/Noise"
+    "BatchedNoise.h"
+    "BatchedNoise.cpp"
+    "FusedNoise.h"
+    "NoiseGraph.h"
+    "NoiseKernels.h"
+    "NoiseKernelsAvx2.cpp"
+    "NoiseKernelsSse41.cpp"
+    "NoiseSettings.h"
+    "TerrainNoiseGraphs.h"
+)
+
+# The SIMD noise kernels are picked at runtime, only their own files get the wider instruction sets.
+enable_instruction_set_for_sources(SSE41 "${BASE_SOURCE_DIRECTORY}/World/TerrainGeneration/Noise/NoiseKernelsSse41.cpp")
+enable_instruction_set_for_sources(AVX2  "${BASE_SOURCE_DIRECTORY}/World/TerrainGeneration/Noise/NoiseKernelsAvx2.cpp")
+
+# The world has to come out the same on every CPU and build type, fast math lets the compiler round each
+# kernel differently. The generators inline the noise graphs, they need it as much as the kernels do.
+enable_precise_float_for_sources(
+    "${BASE_SOURCE_DIRECTORY}/World/TerrainGeneration/Noise/BatchedNoise.cpp"
+    "${BASE_SOURCE_DIRECTORY}/World/TerrainGeneration/Noise/NoiseKernelsSse41.cpp"
+    "${BASE_SOURCE_DIRECTORY}/World/TerrainGeneration/Noise/NoiseKernelsAvx2.cpp"
+    "${BASE_SOURCE_DIRECTORY}/World/TerrainGeneration/BiomeTerrainGen.cpp"
+    "${BASE_SOURCE_DIRECTORY}/World/TerrainGeneration/ChunkDecorator.cpp"
+    "${BASE_SOURCE_DIRECTORY}/World/TerrainGeneration/DensityTerrainGen.cpp"
+    "${BASE_SOURCE_DIRECTORY}/World/TerrainGeneration/HeightfieldTerrainGen.cpp"
+    "${BASE_SOURCE_DIRECTORY}/World/TerrainGeneration/SuperFlatTerrainGen.cpp"
 )
 
 # Source files in World/TerrainGeneration
-RegisterSourceFiles(SOURCE_FILES "${BASE_SOURCE_DIRECTORY}/World/TerrainGeneration"
-    "SimpleTerrainGen.h"
-    "SimpleTerrainGen.cpp"
+RegisterSourceFiles(WORLD_SOURCE_FILES "${BASE_SOURCE_DIRECTORY}/World/TerrainGeneration"
+    "BiomeTerrainGen.h"
+    "BiomeTerrainGen.cpp"
+    "ClimateCache.h"
+    "ClimateCache.cpp"
+    "ChunkDecorator.h"
+    "ChunkDecorator.cpp"
+    "DensityTerrainGen.h"
+    "DensityTerrainGen.cpp"
+    "HeightfieldTerrainGen.h"
+    "HeightfieldTerrainGen.cpp"
     "SuperFlatTerrainGen.h"
     "SuperFlatTerrainGen.cpp"
     "TerrainGenerator.h"
 )
 
 # Source files in World
-RegisterSourceFiles(SOURCE_FILES "${BASE_SOURCE_DIRECTORY}/World"
+RegisterSourceFiles(WORLD_SOURCE_FILES "${BASE_SOURCE_DIRECTORY}/World"
+    "ChunkCache.h"
+    "ChunkCache.cpp"
+    "ChunkDependencyGraph.h"
+    "ChunkDependencyGraph.cpp"
+    "ChunkLifecycleTracker.h"
+    "ChunkLifecycleTracker.cpp"
     "ChunkManager.h"
     "ChunkManager.cpp"
-    "Sky.h"
-    "Sky.cpp"
+    "ChunkMapSnapshot.h"
+    "ChunkMapSnapshot.cpp"
+    "ChunkPregenerator.h"
+    "ChunkPregenerator.cpp"
+    "StreamingCoordinator.h"
+    "StreamingCoordinator.cpp"
+    "StreamingLookAhead.h"
+    "StreamingLookAhead.cpp"
     "World.h"
     "World.cpp"
     "WorldConstants.h"
@@ -185,3 +258,4 @@ RegisterSourceFiles(SOURCE_FILES "${BASE_SOURCE_DIRECTORY}/World"
 
 
 source_group(TREE "${CMAKE_CURRENT_SOURCE_DIR}" FILES ${SOURCE_FILES})
+source_group(TREE "${CMAKE_CURRENT_SOURCE_DIR}" FILES ${WORLD_SOURCE_FILES})
@@ -0,0 +1,43 @@
+# SPDX-License-Identifier: MIT
+# Copyright (c) 2025 Jayantkumar56
+
+
+# Headless tools, they link only the world library (no GLFW, Glad or ImGui).
+option(MCT_BUILD_TOOLS "Build the headless tools in Tools/" ON)
+
+if(NOT MCT_BUILD_TOOLS)
+    return()
+endif()
+
+
+set(TOOLS_SOURCE_DIRECTORY "${CMAKE_CURRENT_SOURCE_DIR}/Tools")
+
+
+# Bulk world pregeneration and pipeline throughput
+add_executable(WorldPregen
+    "${TOOLS_SOURCE_DIRECTORY}/WorldPregen.cpp"
+)
+
+target_link_libraries(WorldPregen PRIVATE ${WORLD_LIB_NAME})
+
+if(WIN32)
+    target_link_libraries(WorldPregen PRIVATE psapi)
+endif()
+
+enable_release_optimizations_for(WorldPregen)
+add_compiler_flags_for(WorldPregen)
+
+set_target_properties(WorldPregen PROPERTIES FOLDER "Tools")
+
+# Fails when the world output no longer matches the committed golden hashes, at any SIMD level the
+# CPU supports. Runs from the repository root so Assets/ is found.
+add_test(NAME WorldPregenGolden
+    COMMAND WorldPregen --check-golden "${TOOLS_SOURCE_DIRECTORY}/WorldPregenGolden.txt"
+    WORKING_DIRECTORY "${CMAKE_CURRENT_SOURCE_DIR}"
+)
+
+# ChunkManager::Request coroutines resolving, unloaded and pending at shutdown, none may leak.
+add_test(NAME WorldPregenRequests
+    COMMAND WorldPregen --check-requests
+    WORKING_DIRECTORY "${CMAKE_CURRENT_SOURCE_DIR}"
+)
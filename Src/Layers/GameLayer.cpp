@@ -11,18 +11,77 @@
 #include "Events/MouseEvents.h"
 #include "Events/EventDispatcher.h"
 #include "Utils/Profiler.h"
+#include "Utils/Logger.h"
 
 #include "imgui.h"
 #include "imgui_internal.h"
 #include <glm/gtc/type_ptr.hpp>
 
+#include <array>
+#include <cfloat>
+
 
 namespace Mct {
 
+	static void DrawWorkerPoolStats(const WorkerPoolMetrics& metrics) {
+		const WorkerPoolStats& stats = metrics.GetStats();
+
+		ImGui::Text("Queue depth: %lld", static_cast<long long>(stats.QueueDepth));
+		ImGui::Text("Throughput: %.1f tasks/s", stats.TasksPerSecond);
+		ImGui::Text("Wait  p50/p95/p99: %.2f / %.2f / %.2f ms", stats.WaitP50Ms, stats.WaitP95Ms, stats.WaitP99Ms);
+		ImGui::Text("Exec  p50/p95/p99: %.2f / %.2f / %.2f ms", stats.ExecP50Ms, stats.ExecP95Ms, stats.ExecP99Ms);
+		ImGui::Text("Completed %llu, failed %llu, dropped %llu",
+			static_cast<unsigned long long>(stats.CompletedTasks),
+			static_cast<unsigned long long>(stats.FailedTasks),
+			static_cast<unsigned long long>(stats.DroppedTasks));
+
+		std::array<float, WorkerPoolStats::BucketCount> execHistogram;
+		for (size_t i = 0; i < WorkerPoolStats::BucketCount; ++i) {
+			execHistogram[i] = static_cast<float>(stats.ExecHistogram[i]);
+		}
+
+		ImGui::PlotHistogram("Exec (log2 us)", execHistogram.data(), static_cast<int>(execHistogram.size()),
+			0, nullptr, 0.0f, FLT_MAX, ImVec2{ 0.0f, 60.0f });
+
+		ImGui::Text("Busy: %.0f%% average", stats.AverageBusyRatio * 100.0f);
+		for (size_t i = 0; i < stats.WorkerBusyRatio.size(); ++i) {
+			ImGui::ProgressBar(stats.WorkerBusyRatio[i], ImVec2{ -1.0f, 0.0f });
+		}
+	}
+
+	static void DrawChunkLifecycle(ChunkLifecycleTracker& tracker) {
+		ImGui::Text("Chunks drawn: %llu (last %zu kept)",
+			static_cast<unsigned long long>(tracker.GetRecordedCount()), tracker.GetSampleCount());
+
+		const auto& percentiles = tracker.GetPercentiles();
+
+		for (size_t span = 0; span < ChunkLifecycleTracker::c_SpanCount; ++span) {
+			ImGui::Text("%-18s p50 %8.2f  p95 %8.2f  p99 %8.2f ms", ChunkLifecycleTracker::GetSpanName(span),
+				percentiles[span].P50Ms, percentiles[span].P95Ms, percentiles[span].P99Ms);
+		}
+
+		if (ImGui::Button("Export CSV")) {
+			tracker.ExportCsv("ChunkLifecycle.csv");
+		}
+	}
+
+	static void DrawChunkPipeline(const ChunkPipelineStats& stats) {
+		ImGui::Text("Terrain: %zu queued, %zu in flight (%llu stalled updates)",
+			stats.TerrainQueued, stats.TerrainInFlight, static_cast<unsigned long long>(stats.TerrainStalls));
+		ImGui::Text("Meshes:  %zu parked, %zu in flight (%llu stalls)",
+			stats.ParkedMeshes, stats.MeshesInFlight, static_cast<unsigned long long>(stats.MeshStalls));
+		ImGui::Text("Uploads: %zu pending", stats.PendingUploads);
+	}
+
 	GameLayer::GameLayer() :
 			m_Player(),
-			m_World(WorldSettings{ TerrainType::SuperFlat })
-	{}
+			m_World(WorldSettings{ TerrainType::Biome })
+	{
+		const glm::vec3 spawn = m_Player.GetPosition();
+		const ChunkCoord spawnChunk = ChunkCoord::FromWorldXZ((int)spawn.x, (int)spawn.z);
+
+		m_SpawnPregen.Start(m_World.GetChunkManager(), ChunkPregenerator::GetSpawnTargets(spawnChunk));
+	}
 
 	void GameLayer::OnEvent(Event& e) {
 		EventDispatcher::Handle<KeyPressedEvent>(e, [this](KeyPressedEvent& event) {
@@ -57,10 +116,15 @@ namespace Mct {
 	}
 
 	void GameLayer::UpdateGameUI(float deltaTime) {
+		// While loading the world streams and uploads around the spawn, the player can't move yet.
+		if (m_Loading) {
+			m_World.Update(deltaTime, m_Player.GetPosition(), glm::vec3(0.0f));
+			m_Renderer.Render(m_World, m_Player);
+		}
 		// Updates game state ony when game window have focus.
-		if (m_GameHaveFocus) {
+		else if (m_GameHaveFocus) {
 			m_Player.OnUpdate(deltaTime);
-			m_World.Update(deltaTime, m_Player.GetPosition());
+			m_World.Update(deltaTime, m_Player.GetPosition(), m_Player.GetVelocity());
 
 			m_Renderer.Render(m_World, m_Player);
 		}
@@ -90,6 +154,14 @@ namespace Mct {
 			}
 		}
 
+		if (m_Loading) {
+			DrawLoadingProgress();
+
+			ImGui::End();
+			ImGui::PopStyleVar(2);
+			return;
+		}
+
 		const uint32_t textureID = m_Renderer.GetFinalTextureID();
 
 		// Note: ImGui's Y-axis is inverted for UVs, so we pass {0, 1} and {1, 0}
@@ -103,6 +175,26 @@ namespace Mct {
 		ImGui::PopStyleVar(2);
 	}
 
+	void GameLayer::DrawLoadingProgress() {
+		const PregenProgress progress = m_SpawnPregen.GetProgress();
+
+		if (progress.IsComplete()) {
+			MCT_INFO("Spawn area ready: {} chunks in {:.2f} s ({:.0f} chunks/s)",
+				progress.Total, progress.Seconds, progress.ChunksPerSecond);
+
+			m_Loading = false;
+		}
+
+		ImGui::SetCursorPos(ImVec2{ m_GameViewportSize.x * 0.25f, m_GameViewportSize.y * 0.5f });
+		ImGui::BeginGroup();
+
+		ImGui::Text("Generating spawn area: %zu / %zu chunks", progress.Completed, progress.Total);
+		ImGui::ProgressBar(progress.GetFraction(), ImVec2{ m_GameViewportSize.x * 0.5f, 0.0f });
+		ImGui::Text("%.1f s, %.0f chunks/s", progress.Seconds, progress.ChunksPerSecond);
+
+		ImGui::EndGroup();
+	}
+
 	void GameLayer::UpdateDebugUI(float deltaTime) {
 		ImGui::Begin("Stats");
 
@@ -148,6 +240,47 @@ namespace Mct {
 
 		ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
 
+		StreamingCoordinator& streaming = m_World.GetStreaming();
+		const StreamingStats& stats     = streaming.GetStats();
+
+		const PregenProgress pregen = m_SpawnPregen.GetProgress();
+		ImGui::Text("Spawn pregeneration: %zu / %zu chunks in %.2f s (%.0f chunks/s)",
+			pregen.Completed, pregen.Total, pregen.Seconds, pregen.ChunksPerSecond);
+
+		ImGui::Text("Streaming: tick %.2f ms, main thread sync %.2f ms", stats.TickMs, stats.SyncMs);
+
+		const MeshLatencyStats& meshLatency = stats.MeshLatency;
+
+		ImGui::Text("Time to first mesh: %.1f ms (avg %.1f ms, max %.1f ms, %llu chunks)",
+			meshLatency.LastMs, meshLatency.AverageMs, meshLatency.MaxMs,
+			static_cast<unsigned long long>(meshLatency.MeshedChunks));
+
+		ImGui::Text("Look-ahead: %d chunks (lead %.2f s)", stats.LookAheadChunks, stats.LookAheadLeadSeconds);
+
+		const ChunkCacheStats& cache = stats.Cache;
+		ImGui::Text("Chunk cache: %zu chunks (%zu meshed), %.1f MiB blocks, %.1f MiB GPU, %llu hits / %llu misses",
+			cache.Entries, cache.EntriesWithMesh,
+			static_cast<float>(cache.CompressedBytes) / (1024.0f * 1024.0f),
+			static_cast<float>(cache.GpuBytes)        / (1024.0f * 1024.0f),
+			static_cast<unsigned long long>(cache.Hits), static_cast<unsigned long long>(cache.Misses));
+
+		const ClimateCacheStats& climate = stats.ClimateCache;
+		ImGui::Text("Climate cache: %zu / %zu tiles, %.1f KiB, %.1f%% hits (%llu evicted)",
+			climate.Entries, climate.Capacity, static_cast<float>(climate.Bytes) / 1024.0f,
+			100.0f * climate.GetHitRate(), static_cast<unsigned long long>(climate.Evictions));
+
+		if (ImGui::CollapsingHeader("Chunk Pipeline")) {
+			DrawChunkPipeline(stats.Pipeline);
+		}
+
+		if (ImGui::CollapsingHeader("Chunk Lifecycle")) {
+			DrawChunkLifecycle(streaming.GetLifecycleTracker());
+		}
+
+		if (ImGui::CollapsingHeader("Job System")) {
+			DrawWorkerPoolStats(m_World.GetJobSystem().GetMetrics());
+		}
+
 		ImGui::End();
 	}
 
@@ -10,6 +10,7 @@
 #include "Application/Layer.h"
 #include "Player/Player.h"
 #include "World/World.h"
+#include "World/ChunkPregenerator.h"
 #include "Renderer/GameRenderer.h"
 
 
@@ -24,6 +25,7 @@ namespace Mct {
 
     private:
         void UpdateGameUI(float deltaTime);
+        void DrawLoadingProgress();
         void UpdateDebugUI(float deltaTime);
 
     private:
@@ -43,6 +45,10 @@ namespace Mct {
         World        m_World;
 
         glm::vec2 m_GameViewportSize = { 0.0f, 0.0f };
+
+        // The game view starts once the spawn area is generated and meshed.
+        ChunkPregenerator m_SpawnPregen;
+        bool              m_Loading = true;
     };
 
 }
@@ -52,6 +52,7 @@ namespace Mct {
 
 		auto& GetCamera()              noexcept { return m_Camera;               }
 		const auto GetPosition() const noexcept { return m_Camera.GetPosition(); }
+		glm::vec3 GetVelocity()  const noexcept { return m_Velocity;              }
 
 		void OnWindowResized(uint16_t width, uint16_t height) { 
 			m_Camera.SetAspectRatio(float(width) / float(height)); 
@@ -23,6 +23,7 @@ namespace Mct {
 
 		auto& GetCamera()              noexcept { return m_CameraController.GetCamera();   }
 		const auto GetPosition() const noexcept { return m_CameraController.GetPosition(); }
+		glm::vec3 GetVelocity()  const noexcept { return m_CameraController.GetVelocity(); }
 
 	private:
 		// TODO: move this to a proper serializer system and read from file.
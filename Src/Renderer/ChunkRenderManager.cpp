@@ -15,6 +15,7 @@ namespace Mct {
 	void ChunkRenderManager::Update(World& world, const Camera& camera, MeshManager& meshManager) {
         m_SolidDrawCommands.clear();
         m_SubchunkPositions.clear();
+        m_UploadsLeft = c_MaxUploadsPerFrame;
 
         const int renderDist = WorldConst::RenderDistance;
         glm::vec3 cameraPos  = camera.GetPosition();
@@ -22,15 +23,28 @@ namespace Mct {
         ChunkCoord cameraCoord = ChunkCoord::FromWorldXZ((int)cameraPos.x, (int)cameraPos.z);
         size_t vertexStride    = meshManager.GetVBOLayout().GetStride();
 
-        for (auto& [coord, chunk] : world.GetChunkManager().GetChunks()) {
-            ProcessChunk(coord, chunk, cameraCoord, renderDist, vertexStride, meshManager);
+        StreamingCoordinator&  streaming        = world.GetStreaming();
+        ChunkLifecycleTracker& lifecycleTracker = streaming.GetLifecycleTracker();
+
+        for (const std::shared_ptr<Chunk>& chunk : streaming.GetRenderableSet().Chunks) {
+            ProcessChunk(chunk, cameraCoord, renderDist, vertexStride, meshManager, lifecycleTracker);
         }
     }
 
-    void ChunkRenderManager::ProcessChunk(const ChunkCoord& coord, std::shared_ptr<Chunk>& chunk, 
+    void ChunkRenderManager::ProcessChunk(const std::shared_ptr<Chunk>& chunk, 
                                           const ChunkCoord& cameraCoord, int renderDist, 
-                                          size_t vertexStride, MeshManager& meshManager) 
+                                          size_t vertexStride, MeshManager& meshManager,
+                                          ChunkLifecycleTracker& lifecycleTracker) 
     {
+        // Upload if Dirty, culled chunks too. Look-ahead chunks are meshed before they come into view
+        // and their CPU meshes would otherwise hold up the pipeline.
+        if (chunk->HaveDirtyMesh() && m_UploadsLeft > 0) {
+            UploadChunkMesh(chunk, meshManager);
+            --m_UploadsLeft;
+        }
+
+        const ChunkCoord coord = chunk->GetCoord();
+
         // Distance Check (Culling)
         int distX = std::abs(coord.X - cameraCoord.X);
         int distZ = std::abs(coord.Z - cameraCoord.Z);
@@ -38,11 +52,6 @@ namespace Mct {
         if (distX > renderDist || distZ > renderDist)
             return;
 
-        // Upload if Dirty
-        if (chunk->HaveDirtyMesh()) {
-            UploadChunkMesh(chunk, meshManager);
-        }
-
         // Build Commands
         // Loop through all subchunks in this chunk
         for (const auto& subchunk : chunk->GetSubchunks()) {
@@ -72,9 +81,17 @@ namespace Mct {
                 );
             }
         }
+
+        ChunkTimeline& timeline = chunk->GetTimeline();
+
+        // Commands built here are drawn this frame.
+        if (timeline.Has(ChunkLifecycleStage::Uploaded) && !timeline.Has(ChunkLifecycleStage::FirstDrawn)) {
+            timeline.Stamp(ChunkLifecycleStage::FirstDrawn);
+            lifecycleTracker.Record(coord, timeline);
+        }
     }
 
-    void ChunkRenderManager::UploadChunkMesh(std::shared_ptr<Chunk>& chunk, MeshManager& meshManager) {
+    void ChunkRenderManager::UploadChunkMesh(const std::shared_ptr<Chunk>& chunk, MeshManager& meshManager) {
         auto cpuMeshes = chunk->GetMeshForUpload();
 
         std::unique_ptr<ChunkGpuMesh> chunkGpuMesh = std::make_unique<ChunkGpuMesh>();
@@ -89,6 +106,7 @@ namespace Mct {
         }
 
         chunk->SetGpuMesh(std::move(chunkGpuMesh));
+        chunk->GetTimeline().Stamp(ChunkLifecycleStage::Uploaded);
     }
 
 }
@@ -19,6 +19,7 @@ namespace Mct {
     class Camera;
     class MeshManager;
     class Chunk;
+    class ChunkLifecycleTracker;
 
     struct ChunkCoord;
 
@@ -31,6 +32,10 @@ namespace Mct {
     };
 
     class ChunkRenderManager {
+    public:
+        // Bounds the upload work of a single frame, the ChunkManager stops meshing when uploads fall behind.
+        static constexpr size_t c_MaxUploadsPerFrame = 64;
+
     public:
         void Update(World& world, const Camera& camera, MeshManager& meshManager);
 
@@ -38,15 +43,16 @@ namespace Mct {
         const std::vector<glm::vec4>& GetSubchunkOffsets() const { return m_SubchunkPositions; }
 
     private:
-        void ProcessChunk(const ChunkCoord& coord, std::shared_ptr<Chunk>& chunk,
-                          const ChunkCoord& cameraCoord, int renderDist,
-                          size_t vertexStride, MeshManager& meshManager);
+        void ProcessChunk(const std::shared_ptr<Chunk>& chunk, const ChunkCoord& cameraCoord, int renderDist,
+                          size_t vertexStride, MeshManager& meshManager,
+                          ChunkLifecycleTracker& lifecycleTracker);
 
-        void UploadChunkMesh(std::shared_ptr<Chunk>& chunk, MeshManager& meshManager);
+        void UploadChunkMesh(const std::shared_ptr<Chunk>& chunk, MeshManager& meshManager);
 
     private:
         std::vector<glm::vec4>                   m_SubchunkPositions;
         std::vector<DrawElementsIndirectCommand> m_SolidDrawCommands;
+        size_t                                   m_UploadsLeft = 0;
     };
 
 }
@@ -5,17 +5,16 @@
 
 
 #include "GpuMeshHandle.h"
-#include "Renderer/MeshManager.h"
 
 
 namespace Mct {
 
-	GpuMeshHandle::GpuMeshHandle(MeshManager*                     manager, 
+	GpuMeshHandle::GpuMeshHandle(GpuMeshOwner*                    manager, 
                                  VertexBufferHandle               vbo, 
                                  std::optional<IndexBufferHandle> ibo) : 
-            m_Manager ( manager ), 
             VboHandle ( vbo     ), 
-            IboHandle ( ibo     )
+            IboHandle ( ibo     ), 
+            m_Manager ( manager )
     {}
 
     GpuMeshHandle::~GpuMeshHandle() {
@@ -25,9 +24,9 @@ namespace Mct {
     }
 
     GpuMeshHandle::GpuMeshHandle(GpuMeshHandle&& other) noexcept : 
-            m_Manager ( other.m_Manager ),
             VboHandle ( other.VboHandle ),
-            IboHandle ( other.IboHandle )
+            IboHandle ( other.IboHandle ),
+            m_Manager ( other.m_Manager )
     {
         // Steal the resource by nulling out the other handle's manager.
         // This prevents its destructor from also freeing the memory.
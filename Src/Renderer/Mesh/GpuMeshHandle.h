@@ -24,7 +24,17 @@ namespace Mct {
     //    std::optional<IndexBufferHandle> IboHandle;
     //};
 
-    class MeshManager;
+    class GpuMeshHandle;
+
+    // Whatever allocated a GpuMeshHandle, told when the handle goes away. Keeps the handles (and
+    // the chunks holding them) free of any GL dependency.
+    class GpuMeshOwner {
+    public:
+        virtual void ScheduleForDeletion(GpuMeshHandle& mesh) = 0;
+
+    protected:
+        ~GpuMeshOwner() = default;
+    };
 
     class GpuMeshHandle : public NonCopyable {
     public:
@@ -36,7 +46,7 @@ namespace Mct {
         std::optional<IndexBufferHandle> IboHandle;
 
         // It can only be created by its manager, which passes a pointer to itself.
-        GpuMeshHandle(MeshManager*                     manager,
+        GpuMeshHandle(GpuMeshOwner*                    manager,
                       VertexBufferHandle               vbo, 
                       std::optional<IndexBufferHandle> ibo);
 
@@ -47,7 +57,7 @@ namespace Mct {
 
     private:
         // Pointer back to the object responsible for deallocation.
-        MeshManager* m_Manager;
+        GpuMeshOwner* m_Manager;
     };
 
 }
@@ -23,7 +23,7 @@ namespace Mct {
         uint32_t        VertexCount   = 0;
         BufferLayout    VertexLayout; 
         uint32_t        IndexCount    = 0;
-        IndexType       IndexType     = IndexType::None;
+        Mct::IndexType  IndexType     = Mct::IndexType::None;
         size_t          InstanceCount = 1;
     };
 
@@ -79,11 +79,13 @@ namespace Mct {
 	}
 
     void MeshManager::Update() {
-        std::vector<GpuMeshHandlesToFree> handlesToFree = m_DeletionQueue.Drain();
+        m_DeletionQueue.DrainInto(m_HandlesToFree);
 
-        for (const auto& handles : handlesToFree) {
+        for (const auto& handles : m_HandlesToFree) {
             FreeMesh(handles);
         }
+
+        m_HandlesToFree.clear();
     }
 
     void MeshManager::ScheduleForDeletion(GpuMeshHandle& mesh) {
@@ -14,7 +14,7 @@
 #include "Primitives/VertexArray.h"
 #include "Mesh/Mesh.h"
 #include "Mesh/GpuMeshHandle.h"
-#include "Utils/ThreadSafeVector.h"
+#include "Utils/MpscChannel.h"
 
 #include <memory>
 #include <optional>
@@ -25,7 +25,7 @@ namespace Mct {
     // Manages GPU buffers and memory allocation for meshes
     // that all share a single, predefined vertex layout.
     //
-    class MeshManager : public NonCopyable {
+    class MeshManager : public NonCopyable, public GpuMeshOwner {
     public:
         MeshManager(const BufferLayout vboLayout,
                     const size_t vertexBufferSize,
@@ -38,7 +38,7 @@ namespace Mct {
 
         void Update();
 
-        void ScheduleForDeletion(GpuMeshHandle& mesh);
+        void ScheduleForDeletion(GpuMeshHandle& mesh) override;
 
         [[nodiscard]] const VertexArray& GetCommonVAO() const noexcept { return m_VertexArray; }
 
@@ -72,7 +72,9 @@ namespace Mct {
 
         BufferLayoutId m_VBOLayoutId = 0;
 
-        ThreadSafeVector<GpuMeshHandlesToFree> m_DeletionQueue;
+        // GpuMeshHandle destructors may run on any thread that drops the last reference to a chunk.
+        MpscChannel<GpuMeshHandlesToFree> m_DeletionQueue{ "MeshDeletionQueue", 8192 };
+        std::vector<GpuMeshHandlesToFree> m_HandlesToFree;
     };
 
 }
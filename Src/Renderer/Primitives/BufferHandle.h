@@ -10,6 +10,7 @@
 #include "Types.h"
 
 #include <cinttypes>
+#include <cstddef>
 
 
 namespace Mct {
@@ -6,7 +6,7 @@
 
 #include "Sky.h"
 #include "Utils/Math.h"
-#include "WorldTime.h"
+#include "World/WorldTime.h"
 
 
 namespace Mct {
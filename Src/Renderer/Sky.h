@@ -7,7 +7,7 @@
 #pragma once
 
 
-#include "Renderer/Primitives/Texture2D.h"
+#include "Primitives/Texture2D.h"
 
 #include <glm/glm.hpp>
 
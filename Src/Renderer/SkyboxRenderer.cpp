@@ -8,7 +8,7 @@
 #include "Utils/FileUtils.h"
 #include "Primitives/VertexArray.h"
 #include "Primitives/Shader.h"
-#include "World/Sky.h"
+#include "Sky.h"
 #include "Camera/Camera.h"
 #include "Utils/Logger.h"
 #include "Utils/CubeData.h"
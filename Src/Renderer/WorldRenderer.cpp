@@ -69,7 +69,9 @@ namespace Mct {
     void WorldRenderer::Render(const Camera& camera, World& world) {
         m_MeshManager->Update();
         m_ChunkRendererManager.Update(world, camera, *m_MeshManager);
-        glm::vec3 sunDir = world.GetSunDirection();
+
+        m_Sky.Update(world.GetGameTime());
+        glm::vec3 sunDir = m_Sky.GetSunDirection();
 
         // Bind Shader and perform draw call
         {
@@ -113,7 +115,7 @@ namespace Mct {
             m_TerrainShader->Unbind();
         }
 
-        m_SkyboxRenderer.Render(camera, world.GetSky());
+        m_SkyboxRenderer.Render(camera, m_Sky);
     }
 
 }
@@ -10,6 +10,7 @@
 #include "Primitives/IndirectBuffer.h"
 #include "Primitives/ShaderStorageBuffer.h"
 #include "SkyboxRenderer.h"
+#include "Sky.h"
 #include "ChunkRenderManager.h"
 
 #include <glm/glm.hpp>
@@ -40,6 +41,7 @@ namespace Mct {
 
         ChunkRenderManager m_ChunkRendererManager;
         SkyboxRenderer     m_SkyboxRenderer;
+        Sky                m_Sky;
 
         std::unique_ptr<Shader>       m_TerrainShader;
         std::unique_ptr<TextureArray> m_BlockTextureArray;
@@ -0,0 +1,20 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include <cstddef>
+#include <new>
+
+
+namespace Mct {
+
+#if defined(__cpp_lib_hardware_interference_size) && !defined(__GNUC__)
+    inline constexpr size_t CacheLineSize = std::hardware_destructive_interference_size;
+#else
+    inline constexpr size_t CacheLineSize = 64;
+#endif
+
+}
@@ -0,0 +1,77 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include "Logger.h"
+#include "NonCopyable.h"
+#include "NonMovable.h"
+
+#include <coroutine>
+#include <exception>
+#include <utility>
+
+
+namespace Mct {
+
+    // Return type of fire-and-forget coroutines.
+    //
+    // The coroutine starts running as soon as it is called and frees its own frame when it finishes,
+    // there is nothing to wait on or to keep alive. Whatever it co_awaits decides on which thread it
+    // continues. Exceptions escaping the coroutine are logged and dropped.
+    //
+    // Usage:
+    //     DetachedTask PlaceSpawn(ChunkManager& chunks, ChunkCoord coord) {
+    //         std::shared_ptr<Chunk> chunk = co_await chunks.Request(coord, ChunkStage::Generated);
+    //         ...
+    //     }
+    //
+    class DetachedTask {
+    public:
+        struct promise_type {
+            DetachedTask get_return_object() const noexcept { return {}; }
+
+            std::suspend_never initial_suspend() const noexcept { return {}; }
+            std::suspend_never final_suspend()   const noexcept { return {}; }
+
+            void return_void() const noexcept {}
+
+            void unhandled_exception() const noexcept {
+                try {
+                    std::rethrow_exception(std::current_exception());
+                }
+                catch (const std::exception& e) {
+                    MCT_ERROR("Unhandled exception in detached coroutine: {}", e.what());
+                }
+                catch (...) {
+                    MCT_ERROR("Unhandled unknown exception in detached coroutine.");
+                }
+            }
+        };
+    };
+
+    // A suspended coroutine handed over to be resumed elsewhere, typically shared by a job. Destroys
+    // the frame if it was never resumed, so dropping the job (a stopping JobSystem discards both
+    // rejected and queued ones) frees the frame and whatever it holds instead of leaking them.
+    class SuspendedCoroutine : public NonCopyable, public NonMovable {
+    public:
+        explicit SuspendedCoroutine(std::coroutine_handle<> handle) noexcept :
+                m_Handle ( handle )
+        {}
+
+        ~SuspendedCoroutine() {
+            if (m_Handle) {
+                m_Handle.destroy();
+            }
+        }
+
+        // At most once.
+        void Resume() { std::exchange(m_Handle, nullptr).resume(); }
+
+    private:
+        std::coroutine_handle<> m_Handle;
+    };
+
+}
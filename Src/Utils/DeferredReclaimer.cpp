@@ -0,0 +1,28 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#include "DeferredReclaimer.h"
+#include "Profiler.h"
+
+
+namespace Mct {
+
+    void DeferredReclaimer::Flush() {
+        if (m_Pending.empty())
+            return;
+
+        MCT_PROFILE_VALUE("ReclaimedObjects", static_cast<int64_t>(m_Pending.size()));
+
+        // Job_T must be copyable, the batch is shared and emptied by whichever copy runs. If the
+        // pool is already shutting down the job is dropped and the batch is freed right here.
+        auto batch = std::make_shared<Batch_T>(std::move(m_Pending));
+        m_Pending.clear();
+
+        m_JobSystem.Submit(JobKind::Reclaim, JobPriority::Normal, [batch] {
+            MCT_PROFILE_SCOPE("Reclaim");
+            batch->clear();
+        });
+    }
+
+}
@@ -0,0 +1,55 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include "NonCopyable.h"
+#include "NonMovable.h"
+#include "JobSystem.h"
+
+#include <memory>
+#include <vector>
+
+
+namespace Mct {
+
+    // Moves the destruction of dead objects off the thread that drops them.
+    //
+    // Retired objects are only collected, Flush() hands everything collected so far to a single
+    // job which destroys them on a worker. A shared_ptr still referenced elsewhere is destroyed
+    // by whoever drops the last reference.
+    //
+    // Retire() and Flush() must be called from one thread.
+    //
+    class DeferredReclaimer : public NonCopyable, public NonMovable {
+    public:
+        explicit DeferredReclaimer(JobSystem& jobSystem) : m_JobSystem(jobSystem) {}
+
+        template<typename T>
+        void Retire(std::shared_ptr<T> object) {
+            if (object) {
+                m_Pending.push_back(std::move(object));
+            }
+        }
+
+        template<typename T>
+        void Retire(std::unique_ptr<T> object) {
+            if (object) {
+                m_Pending.emplace_back(std::move(object));
+            }
+        }
+
+        void Flush();
+
+        [[nodiscard]] size_t GetPendingCount() const noexcept { return m_Pending.size(); }
+
+    private:
+        using Batch_T = std::vector<std::shared_ptr<void>>;
+
+        JobSystem& m_JobSystem;
+        Batch_T    m_Pending;
+    };
+
+}
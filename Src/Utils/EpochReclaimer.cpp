@@ -0,0 +1,87 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#include "EpochReclaimer.h"
+#include "Profiler.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <thread>
+
+
+namespace Mct {
+
+    EpochReclaimer::ReadGuard::ReadGuard(EpochReclaimer& reclaimer) noexcept :
+            m_Slot ( reclaimer.AcquireSlot() )
+    {}
+
+    EpochReclaimer::ReadGuard::~ReadGuard() {
+        m_Slot.store(c_Inactive, std::memory_order_release);
+    }
+
+    EpochReclaimer::EpochReclaimer(const size_t maxReaders) :
+            m_SlotCount ( std::max<size_t>(maxReaders, 1)             ),
+            m_Slots     ( std::make_unique<ReaderSlot[]>(m_SlotCount) )
+    {}
+
+    std::atomic<uint64_t>& EpochReclaimer::AcquireSlot() noexcept {
+        // Threads start probing at different slots, so they rarely contend on the same one.
+        const size_t start = std::hash<std::thread::id>{}(std::this_thread::get_id());
+
+        while (true) {
+            for (size_t i = 0; i < m_SlotCount; ++i) {
+                std::atomic<uint64_t>& slot = m_Slots[(start + i) % m_SlotCount].Epoch;
+
+                // Sequentially consistent, so either the writer sees this slot while collecting or the
+                // reader sees the object published before that collection (never freed by it).
+                uint64_t expected = c_Inactive;
+                if (slot.compare_exchange_strong(expected, m_GlobalEpoch.load(std::memory_order_seq_cst),
+                                                 std::memory_order_seq_cst))
+                {
+                    return slot;
+                }
+            }
+
+            std::this_thread::yield();
+        }
+    }
+
+    void EpochReclaimer::Retire(std::shared_ptr<void> object) {
+        if (!object)
+            return;
+
+        // Readers that entered after this point can't have seen the object anymore.
+        const uint64_t epoch = m_GlobalEpoch.fetch_add(1, std::memory_order_seq_cst);
+        m_Retired.push_back(Retired{ epoch, std::move(object) });
+    }
+
+    void EpochReclaimer::Collect(DeferredReclaimer& reclaimer) {
+        if (m_Retired.empty())
+            return;
+
+        uint64_t oldestReader = std::numeric_limits<uint64_t>::max();
+
+        for (size_t i = 0; i < m_SlotCount; ++i) {
+            const uint64_t epoch = m_Slots[i].Epoch.load(std::memory_order_seq_cst);
+
+            if (epoch != c_Inactive) {
+                oldestReader = std::min(oldestReader, epoch);
+            }
+        }
+
+        auto firstKept = std::find_if(m_Retired.begin(), m_Retired.end(), [oldestReader](const Retired& retired) {
+            return retired.Epoch >= oldestReader;
+        });
+
+        for (auto it = m_Retired.begin(); it != firstKept; ++it) {
+            reclaimer.Retire(std::move(it->Object));
+        }
+
+        m_Retired.erase(m_Retired.begin(), firstKept);
+
+        MCT_PROFILE_VALUE("EpochRetiredObjects", static_cast<int64_t>(m_Retired.size()));
+    }
+
+}
@@ -0,0 +1,81 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include "NonCopyable.h"
+#include "NonMovable.h"
+#include "CacheLine.h"
+#include "DeferredReclaimer.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+
+namespace Mct {
+
+    // Epoch based reclamation for read-mostly data published by a single writer.
+    //
+    // A reader announces the global epoch in a slot for as long as its ReadGuard lives. The writer
+    // replaces the published object first and retires the old one afterwards, the retirement
+    // advances the epoch. A retired object is only released once every reader has left the epoch
+    // it was retired in, so readers can keep using raw pointers without touching any reference count.
+    //
+    // ReadGuard: any thread, up to maxReaders at once, more readers wait for a slot to free up. Size it
+    // from the threads that may read, the JobSystem's worker count for jobs. Retire() and Collect():
+    // writer thread only.
+    //
+    class EpochReclaimer : public NonCopyable, public NonMovable {
+    public:
+        class ReadGuard : public NonCopyable, public NonMovable {
+        public:
+            explicit ReadGuard(EpochReclaimer& reclaimer) noexcept;
+            ~ReadGuard();
+
+        private:
+            std::atomic<uint64_t>& m_Slot;
+        };
+
+    public:
+        explicit EpochReclaimer(size_t maxReaders);
+
+        // Releases every retired object, no reader may be left.
+        ~EpochReclaimer() = default;
+
+        // Call after the object was unpublished, readers still inside may keep using it.
+        void Retire(std::shared_ptr<void> object);
+
+        // Hands the retired objects no reader can see anymore to reclaimer.
+        void Collect(DeferredReclaimer& reclaimer);
+
+        [[nodiscard]] size_t GetRetiredCount() const noexcept { return m_Retired.size(); }
+
+    private:
+        struct alignas(CacheLineSize) ReaderSlot {
+            std::atomic<uint64_t> Epoch{ c_Inactive };
+        };
+
+        struct Retired {
+            uint64_t              Epoch;
+            std::shared_ptr<void> Object;
+        };
+
+        static constexpr uint64_t c_Inactive = 0;
+
+    private:
+        std::atomic<uint64_t>& AcquireSlot() noexcept;
+
+    private:
+        alignas(CacheLineSize) std::atomic<uint64_t> m_GlobalEpoch{ 1 };
+        size_t                                       m_SlotCount;
+        std::unique_ptr<ReaderSlot[]>                m_Slots;
+
+        // Oldest first, epochs only grow.
+        std::vector<Retired> m_Retired;
+    };
+
+}
@@ -14,7 +14,7 @@
 
 namespace Mct {
 
-    [[nodiscard]] static inline bool LoadImageInto(Image& img, const char* path, bool flip, int forceChannels) noexcept {
+    [[nodiscard]] bool LoadImageInto(Image& img, const char* path, bool flip, int forceChannels) noexcept {
         if (img) {
             img.FreeImage();
         }
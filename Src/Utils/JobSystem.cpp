@@ -0,0 +1,273 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#include "JobSystem.h"
+#include "Logger.h"
+#include "Profiler.h"
+
+#include <algorithm>
+#include <exception>
+#include <iterator>
+#include <string>
+
+
+namespace Mct {
+
+    // Identifies the worker (and the pool it belongs to) running on the current thread.
+    static thread_local const JobSystem* t_WorkerOwner = nullptr;
+    static thread_local size_t           t_WorkerIndex = 0;
+
+    static constexpr const char* c_JobKindNames[] = { "Terrain", "Decoration", "Mesh", "Lighting", "IO", "Continuation", "Reclaim" };
+    static_assert(std::size(c_JobKindNames) == static_cast<size_t>(JobKind::COUNT));
+
+    size_t JobSystem::GetDefaultWorkerCount() noexcept {
+        const size_t hardwareThreads = std::thread::hardware_concurrency();
+
+        // hardware_concurrency() is allowed to return 0 when it can't tell.
+        if (hardwareThreads <= 1)
+            return 1;
+
+        return hardwareThreads - 1;
+    }
+
+    std::optional<size_t> JobSystem::GetCurrentWorkerIndex() noexcept {
+        if (t_WorkerOwner == nullptr)
+            return std::nullopt;
+
+        return t_WorkerIndex;
+    }
+
+    JobSystem::JobSystem(size_t numWorkers) :
+            m_Metrics("JobSystem", std::max<size_t>(numWorkers, 1))
+    {
+        numWorkers = std::max<size_t>(numWorkers, 1);
+
+        m_Queues.reserve(numWorkers);
+        for (size_t i = 0; i < numWorkers; ++i) {
+            m_Queues.emplace_back(std::make_unique<WorkerQueue>());
+        }
+
+        // Queues must all exist before any worker starts stealing from them.
+        m_Workers.reserve(numWorkers);
+        for (size_t i = 0; i < numWorkers; ++i) {
+            m_Workers.emplace_back([this, i] { WorkerLoop(i); });
+        }
+    }
+
+    JobSystem::~JobSystem() {
+        Shutdown();
+
+        for (std::thread& worker : m_Workers) {
+            if (worker.joinable()) worker.join();
+        }
+    }
+
+    bool JobSystem::Submit(JobKind kind, JobPriority priority, Job_T job) {
+        if (m_Stop.load(std::memory_order_acquire)) {
+            m_Metrics.OnDropped(1);
+            return false; // Pool is shutting down
+        }
+
+        // Counted before the push, a worker may see the count early and retry, but never underflows it.
+        m_PendingJobs.fetch_add(1, std::memory_order_acq_rel);
+        m_Metrics.OnEnqueued(1);
+
+        const auto now = WorkerPoolMetrics::Clock_T::now();
+
+        WorkerQueue& queue = *m_Queues[PickQueueForSubmit()];
+        {
+            std::lock_guard<std::mutex> lock(queue.Mutex);
+            queue.Jobs[static_cast<size_t>(priority)].push_back(QueuedJob{ JobDesc{ kind, priority, std::move(job) }, now });
+        }
+
+        WakeWorkers(1);
+        return true;
+    }
+
+    bool JobSystem::SubmitBatch(std::vector<JobDesc>&& jobs) {
+        if (m_Stop.load(std::memory_order_acquire)) {
+            m_Metrics.OnDropped(jobs.size());
+            return false; // Pool is shutting down
+        }
+
+        if (jobs.empty())
+            return true;
+
+        m_PendingJobs.fetch_add(jobs.size(), std::memory_order_acq_rel);
+        m_Metrics.OnEnqueued(jobs.size());
+
+        const auto now = WorkerPoolMetrics::Clock_T::now();
+
+        const std::optional<size_t> submitterIdx = (t_WorkerOwner == this)
+                                                 ? std::optional<size_t>(t_WorkerIndex)
+                                                 : std::nullopt;
+
+        if (submitterIdx) {
+            // Keep them local, idle workers will steal what they need.
+            WorkerQueue& queue = *m_Queues[*submitterIdx];
+            std::lock_guard<std::mutex> lock(queue.Mutex);
+
+            for (JobDesc& job : jobs) {
+                queue.Jobs[static_cast<size_t>(job.Priority)].push_back(QueuedJob{ std::move(job), now });
+            }
+        }
+        else {
+            // Deal jobs over the workers in contiguous runs, so each queue lock is taken once.
+            const size_t workerCount = m_Queues.size();
+            const size_t runLength   = (jobs.size() + workerCount - 1) / workerCount;
+            const size_t firstQueue  = m_NextQueue.fetch_add(1, std::memory_order_relaxed);
+
+            for (size_t begin = 0, run = 0; begin < jobs.size(); begin += runLength, ++run) {
+                const size_t end = std::min(begin + runLength, jobs.size());
+
+                WorkerQueue& queue = *m_Queues[(firstQueue + run) % workerCount];
+                std::lock_guard<std::mutex> lock(queue.Mutex);
+
+                for (size_t i = begin; i < end; ++i) {
+                    queue.Jobs[static_cast<size_t>(jobs[i].Priority)].push_back(QueuedJob{ std::move(jobs[i]), now });
+                }
+            }
+        }
+
+        WakeWorkers(jobs.size());
+        return true;
+    }
+
+    void JobSystem::Shutdown() noexcept {
+        bool expected = false;
+
+        if (m_Stop.compare_exchange_strong(expected, true)) {
+            {
+                std::lock_guard<std::mutex> lock(m_SleepMutex);
+            }
+
+            m_SleepCondition.notify_all();
+        }
+    }
+
+    void JobSystem::WorkerLoop(const size_t workerIdx) {
+        t_WorkerOwner = this;
+        t_WorkerIndex = workerIdx;
+
+        const std::string threadName = "JobWorker " + std::to_string(workerIdx);
+        MCT_PROFILE_THREAD(threadName.c_str());
+
+        while (true) {
+            if (m_Stop.load(std::memory_order_acquire))
+                return;
+
+            std::optional<QueuedJob> job = FindJob(workerIdx);
+
+            if (!job) {
+                std::unique_lock<std::mutex> lock(m_SleepMutex);
+                m_SleepCondition.wait(lock, [this] {
+                    return m_Stop.load(std::memory_order_acquire) ||
+                           m_PendingJobs.load(std::memory_order_acquire) > 0;
+                });
+
+                continue;
+            }
+
+            const auto startTime = WorkerPoolMetrics::Clock_T::now();
+            m_Metrics.OnStarted(startTime - job->EnqueueTime);
+
+            const char* kindName = c_JobKindNames[static_cast<size_t>(job->Desc.Kind)];
+            bool        failed   = false;
+
+            // Execute job and guard against exceptions so threads don't call std::terminate.
+            try {
+                MCT_PROFILE_SCOPE("Job");
+                MCT_PROFILE_ZONE_TEXT(kindName, std::char_traits<char>::length(kindName));
+
+                job->Desc.Job();
+            }
+            catch (const std::exception& e) {
+                failed = true;
+                MCT_ERROR("{} job failed on worker {}: {}", kindName, workerIdx, e.what());
+            }
+            catch (...) {
+                failed = true;
+                MCT_ERROR("{} job failed on worker {} with an unknown exception.", kindName, workerIdx);
+            }
+
+            m_Metrics.OnFinished(workerIdx, WorkerPoolMetrics::Clock_T::now() - startTime, failed);
+        }
+    }
+
+    std::optional<JobSystem::QueuedJob> JobSystem::FindJob(const size_t workerIdx) {
+        for (size_t p = 0; p < static_cast<size_t>(JobPriority::COUNT); ++p) {
+            const JobPriority priority = static_cast<JobPriority>(p);
+
+            if (std::optional<QueuedJob> job = PopOwn(workerIdx, priority))
+                return job;
+
+            if (std::optional<QueuedJob> job = Steal(workerIdx, priority))
+                return job;
+        }
+
+        return std::nullopt;
+    }
+
+    std::optional<JobSystem::QueuedJob> JobSystem::PopOwn(const size_t workerIdx, const JobPriority priority) {
+        WorkerQueue& queue = *m_Queues[workerIdx];
+        std::lock_guard<std::mutex> lock(queue.Mutex);
+
+        auto& jobs = queue.Jobs[static_cast<size_t>(priority)];
+        if (jobs.empty())
+            return std::nullopt;
+
+        QueuedJob job = std::move(jobs.back());
+        jobs.pop_back();
+
+        m_PendingJobs.fetch_sub(1, std::memory_order_acq_rel);
+        return job;
+    }
+
+    std::optional<JobSystem::QueuedJob> JobSystem::Steal(const size_t thiefIdx, const JobPriority priority) {
+        const size_t workerCount = m_Queues.size();
+
+        // Start right after the thief so that victims are spread evenly between thieves.
+        for (size_t offset = 1; offset < workerCount; ++offset) {
+            WorkerQueue& victim = *m_Queues[(thiefIdx + offset) % workerCount];
+
+            std::unique_lock<std::mutex> lock(victim.Mutex, std::try_to_lock);
+            if (!lock.owns_lock())
+                continue;  // Someone is already busy with this queue, try the next one.
+
+            auto& jobs = victim.Jobs[static_cast<size_t>(priority)];
+            if (jobs.empty())
+                continue;
+
+            QueuedJob job = std::move(jobs.front());
+            jobs.pop_front();
+
+            m_PendingJobs.fetch_sub(1, std::memory_order_acq_rel);
+            return job;
+        }
+
+        return std::nullopt;
+    }
+
+    size_t JobSystem::PickQueueForSubmit() noexcept {
+        if (t_WorkerOwner == this)
+            return t_WorkerIndex;
+
+        return m_NextQueue.fetch_add(1, std::memory_order_relaxed) % m_Queues.size();
+    }
+
+    void JobSystem::WakeWorkers(const size_t jobCount) {
+        // Taking the lock orders this notify after any worker's predicate check, so no wakeup is lost.
+        {
+            std::lock_guard<std::mutex> lock(m_SleepMutex);
+        }
+
+        if (jobCount == 1) {
+            m_SleepCondition.notify_one();
+        }
+        else {
+            m_SleepCondition.notify_all();
+        }
+    }
+
+}
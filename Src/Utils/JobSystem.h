@@ -0,0 +1,126 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include "NonCopyable.h"
+#include "NonMovable.h"
+#include "WorkerPoolMetrics.h"
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <optional>
+#include <memory>
+#include <cstdint>
+
+
+namespace Mct {
+
+    // What a job does. Used for bookkeeping, the scheduler itself treats all kinds the same.
+    enum class JobKind : uint8_t {
+        Terrain,
+        Decoration,     // Grows the trees of a chunk once its neighbors are generated.
+        Mesh,
+        Lighting,
+        IO,
+        Continuation,   // Resumes a coroutine which asked to continue on a worker.
+        Reclaim,        // Frees memory of objects retired by the main thread.
+        COUNT
+    };
+
+    // Workers always drain higher priority classes (lower value) first, across all workers.
+    enum class JobPriority : uint8_t {
+        High,
+        Normal,
+        Low,
+        COUNT
+    };
+
+    // Single work-stealing scheduler shared by every background system of the game.
+    //
+    // Each worker owns one deque per priority class. A worker pops its own jobs LIFO (cache warm)
+    // and, when its own deque of a class is empty, steals FIFO from the other workers before
+    // falling back to the next priority class. Jobs submitted from outside the pool are spread
+    // round-robin over the workers, jobs submitted from inside a job go to the submitting worker.
+    //
+    class JobSystem : public NonCopyable, public NonMovable {
+    public:
+        using Job_T = std::function<void()>;
+
+        struct JobDesc {
+            JobKind     Kind     = JobKind::Terrain;
+            JobPriority Priority = JobPriority::Normal;
+            Job_T       Job;
+        };
+
+    public:
+        // Leaves one hardware thread for the main thread.
+        [[nodiscard]] static size_t GetDefaultWorkerCount() noexcept;
+
+        // Index of the worker running the calling thread, std::nullopt for non worker threads.
+        [[nodiscard]] static std::optional<size_t> GetCurrentWorkerIndex() noexcept;
+
+    public:
+        explicit JobSystem(size_t numWorkers = GetDefaultWorkerCount());
+        ~JobSystem();
+
+        bool Submit(JobKind kind, JobPriority priority, Job_T job);
+        bool SubmitBatch(std::vector<JobDesc>&& jobs);
+
+        // Initiate shutdown. Queued jobs which have not started yet are discarded.
+        void Shutdown() noexcept;
+
+        [[nodiscard]] size_t GetWorkerCount() const noexcept { return m_Workers.size(); }
+
+        // Number of jobs queued but not yet picked by any worker.
+        [[nodiscard]] size_t GetPendingJobCount() const noexcept {
+            return m_PendingJobs.load(std::memory_order_relaxed);
+        }
+
+        // Call Sample() on it once per frame from the main thread.
+        [[nodiscard]] WorkerPoolMetrics& GetMetrics() noexcept { return m_Metrics; }
+
+    private:
+        struct QueuedJob {
+            JobDesc                                Desc;
+            WorkerPoolMetrics::Clock_T::time_point EnqueueTime;
+        };
+
+        struct WorkerQueue {
+            std::mutex Mutex;
+            std::deque<QueuedJob> Jobs[static_cast<size_t>(JobPriority::COUNT)];
+        };
+
+    private:
+        void WorkerLoop(size_t workerIdx);
+
+        std::optional<QueuedJob> PopOwn(size_t workerIdx, JobPriority priority);
+        std::optional<QueuedJob> Steal(size_t thiefIdx, JobPriority priority);
+        std::optional<QueuedJob> FindJob(size_t workerIdx);
+
+        size_t PickQueueForSubmit() noexcept;
+        void   WakeWorkers(size_t jobCount);
+
+    private:
+        std::atomic<bool>   m_Stop{ false };
+        std::atomic<size_t> m_PendingJobs{ 0 };
+        std::atomic<size_t> m_NextQueue{ 0 };
+
+        WorkerPoolMetrics   m_Metrics;
+
+        // One per worker, never resized after construction.
+        std::vector<std::unique_ptr<WorkerQueue>> m_Queues;
+        std::vector<std::thread>                  m_Workers;
+
+        std::mutex              m_SleepMutex;
+        std::condition_variable m_SleepCondition;
+    };
+
+}
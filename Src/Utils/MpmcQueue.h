@@ -0,0 +1,130 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include "NonCopyable.h"
+#include "NonMovable.h"
+#include "CacheLine.h"
+
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+
+
+namespace Mct {
+
+    // Bounded lock-free multi-producer multi-consumer ring buffer (Dmitry Vyukov's design).
+    //
+    // Every slot carries a sequence number telling whether it is ready to be written or read
+    // for the current lap of the ring, so producers and consumers only contend on their own
+    // position counter and never on a lock. The capacity is rounded up to a power of two.
+    //
+    template<typename T>
+    class MpmcQueue : public NonCopyable, public NonMovable {
+        static_assert(std::is_nothrow_move_constructible_v<T>, "T must be nothrow-move-constructible.");
+
+        struct Slot {
+            std::atomic<size_t> Sequence;
+            alignas(T) unsigned char Storage[sizeof(T)];
+
+            T* Ptr() noexcept { return std::launder(reinterpret_cast<T*>(Storage)); }
+        };
+
+    public:
+        explicit MpmcQueue(const size_t capacity) :
+                m_Mask  ( std::bit_ceil(capacity < 2 ? size_t{ 2 } : capacity) - 1 ),
+                m_Slots ( std::make_unique<Slot[]>(m_Mask + 1)                   )
+        {
+            for (size_t i = 0; i <= m_Mask; ++i) {
+                m_Slots[i].Sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        ~MpmcQueue() {
+            while (TryPop()) {}
+        }
+
+        // Returns false when the queue is full, the item is left untouched in that case.
+        template<typename Item_T>
+        requires std::is_same_v<std::decay_t<Item_T>, T>
+        bool TryPush(Item_T&& item) noexcept(std::is_nothrow_constructible_v<T, Item_T&&>) {
+            size_t pos = m_EnqueuePos.load(std::memory_order_relaxed);
+
+            while (true) {
+                Slot& slot = m_Slots[pos & m_Mask];
+
+                const size_t   seq  = slot.Sequence.load(std::memory_order_acquire);
+                const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+                if (diff == 0) {
+                    // Slot is free for this lap, try to claim it.
+                    if (m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        ::new (slot.Storage) T(std::forward<Item_T>(item));
+                        slot.Sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0) {
+                    return false; // Full, the consumer of the previous lap hasn't freed it yet.
+                }
+                else {
+                    pos = m_EnqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // Returns std::nullopt when there is no published item at the head.
+        std::optional<T> TryPop() noexcept {
+            size_t pos = m_DequeuePos.load(std::memory_order_relaxed);
+
+            while (true) {
+                Slot& slot = m_Slots[pos & m_Mask];
+
+                const size_t   seq  = slot.Sequence.load(std::memory_order_acquire);
+                const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+
+                if (diff == 0) {
+                    if (m_DequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        std::optional<T> item(std::move(*slot.Ptr()));
+                        slot.Ptr()->~T();
+
+                        // Hand the slot to the producers of the next lap.
+                        slot.Sequence.store(pos + m_Mask + 1, std::memory_order_release);
+                        return item;
+                    }
+                }
+                else if (diff < 0) {
+                    return std::nullopt; // Empty (or the producer of this slot is still writing).
+                }
+                else {
+                    pos = m_DequeuePos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        [[nodiscard]] size_t Capacity() const noexcept { return m_Mask + 1; }
+
+        // Approximate, includes items whose producer claimed a slot but hasn't finished writing.
+        [[nodiscard]] size_t ApproxSize() const noexcept {
+            const size_t enqueuePos = m_EnqueuePos.load(std::memory_order_acquire);
+            const size_t dequeuePos = m_DequeuePos.load(std::memory_order_acquire);
+
+            return enqueuePos > dequeuePos ? enqueuePos - dequeuePos : 0;
+        }
+
+    private:
+        const size_t            m_Mask;
+        std::unique_ptr<Slot[]> m_Slots;
+
+        // Kept on separate cache lines, producers and consumers would false-share otherwise.
+        alignas(CacheLineSize) std::atomic<size_t> m_EnqueuePos{ 0 };
+        alignas(CacheLineSize) std::atomic<size_t> m_DequeuePos{ 0 };
+    };
+
+}
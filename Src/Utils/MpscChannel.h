@@ -0,0 +1,102 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include "NonCopyable.h"
+#include "NonMovable.h"
+#include "MpmcQueue.h"
+#include "Profiler.h"
+
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+
+namespace Mct {
+
+    // Lock-free result channel: any number of producer threads, exactly one consumer thread.
+    //
+    // Producers push into a bounded MpmcQueue ring. Only when the ring is full does a push fall back
+    // to a mutex guarded overflow vector, so in steady state pushes never take a lock and drains never
+    // allocate (the consumer keeps reusing its own output vector). Items are not strictly FIFO once
+    // the overflow path has been used.
+    //
+    template<typename T>
+    class MpscChannel : public NonCopyable, public NonMovable {
+    public:
+        // name is used as the profiler plot of the channel depth, it must be a string literal.
+        explicit MpscChannel(const char* name, const size_t capacity = 1024) :
+                m_Name ( name     ),
+                m_Ring ( capacity )
+        {}
+
+        template<typename Item_T>
+        requires std::is_same_v<std::decay_t<Item_T>, T>
+        void Push(Item_T&& item) {
+            if (m_Ring.TryPush(std::forward<Item_T>(item)))
+                return;
+
+            std::lock_guard<std::mutex> lock(m_OverflowMutex);
+            m_Overflow.emplace_back(std::forward<Item_T>(item));
+            m_HasOverflow.store(true, std::memory_order_release);
+            m_OverflowCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Consumer only. Appends every item available right now to out and returns how many were added.
+        size_t DrainInto(std::vector<T>& out) {
+            const size_t depth = ApproxSize();
+            MCT_PROFILE_VALUE(m_Name, static_cast<int64_t>(depth));
+
+            const size_t oldSize = out.size();
+
+            // Bounded by the depth seen above, so producers running at full speed can't starve the consumer.
+            for (size_t i = 0; i < depth; ++i) {
+                std::optional<T> item = m_Ring.TryPop();
+                if (!item)
+                    break;
+
+                out.emplace_back(std::move(*item));
+            }
+
+            if (m_HasOverflow.load(std::memory_order_acquire)) {
+                std::lock_guard<std::mutex> lock(m_OverflowMutex);
+
+                for (T& item : m_Overflow) {
+                    out.emplace_back(std::move(item));
+                }
+
+                m_Overflow.clear();
+                m_HasOverflow.store(false, std::memory_order_relaxed);
+            }
+
+            return out.size() - oldSize;
+        }
+
+        // Approximate, producers may be pushing concurrently.
+        [[nodiscard]] size_t ApproxSize() const noexcept {
+            return m_Ring.ApproxSize() + (m_HasOverflow.load(std::memory_order_relaxed) ? 1 : 0);
+        }
+
+        // Number of pushes which found the ring full, a hint that the capacity is too small.
+        [[nodiscard]] uint64_t GetOverflowCount() const noexcept {
+            return m_OverflowCount.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] const char* GetName() const noexcept { return m_Name; }
+
+    private:
+        const char*  m_Name;
+        MpmcQueue<T> m_Ring;
+
+        std::mutex            m_OverflowMutex;
+        std::vector<T>        m_Overflow;
+        std::atomic<bool>     m_HasOverflow{ false };
+        std::atomic<uint64_t> m_OverflowCount{ 0 };
+    };
+
+}
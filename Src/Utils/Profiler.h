@@ -26,6 +26,12 @@
 // Profile a lock/mutex (If debugging thread contention).
 #define MCT_PROFILE_LOCK(Type, Var, Name) Type Var; TracyLockableN(Type, Var, Name)
 
+// Name the calling thread in the profiler (the name is copied).
+#define MCT_PROFILE_THREAD(Name)   tracy::SetThreadName(Name)
+
+// Attach a runtime string to the enclosing profiled scope.
+#define MCT_PROFILE_ZONE_TEXT(Text, Size) ZoneText(Text, Size)
+
 #else
 
 #define MCT_PROFILE_FRAME(Name)
@@ -33,5 +39,7 @@
 #define MCT_PROFILE_FUNCTION()
 #define MCT_PROFILE_VALUE(Name, Val)
 #define MCT_PROFILE_LOCK(Type, Var, Name) Type Var
+#define MCT_PROFILE_THREAD(Name)
+#define MCT_PROFILE_ZONE_TEXT(Text, Size)
 
 #endif
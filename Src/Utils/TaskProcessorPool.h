@@ -9,34 +9,65 @@
 
 #include "NonCopyable.h"
 #include "NonMovable.h"
+#include "TaskQueues.h"
+#include "WorkerPoolMetrics.h"
+#include "Logger.h"
+#include "Profiler.h"
 
 #include <vector>
-#include <queue>
 #include <thread>
-#include <mutex>
-#include <condition_variable>
 #include <atomic>
+#include <exception>
+#include <iterator>
+#include <optional>
+#include <string>
 #include <type_traits>
 
 
 namespace Mct {
 
-    template<typename Task_T, typename Functor_T>
+    // Queue_T selects the queue backend (see TaskQueues.h), LockedTaskQueue by default.
+    // LockFreeTaskQueue trades a bounded capacity for lock-free submits and batched wakeups.
+    //
+    // name labels the worker threads and the metrics plots in the profiler.
+    //
+    template<typename Task_T, typename Functor_T, typename Queue_T = LockedTaskQueue<Task_T>>
     requires std::invocable<Functor_T, Task_T&&> || std::invocable<Functor_T, Task_T&>
     class TaskProcessorPool : public NonCopyable, public NonMovable {
         static_assert(std::is_nothrow_move_constructible_v<Task_T>, "Task_T must be nothrow-move-constructible.");
 
+        using Clock_T = WorkerPoolMetrics::Clock_T;
+
+        // Tasks are stamped on submit, so the metrics can tell how long they waited in the queue.
+        struct QueuedTask {
+            Task_T              Task;
+            Clock_T::time_point EnqueueTime;
+        };
+
+        // Stamps the tasks of a batch while the backend copies/moves them in, without a temporary vector.
+        template<typename It>
+        struct StampingIterator {
+            It                  Current;
+            Clock_T::time_point Now;
+
+            QueuedTask        operator*() const { return QueuedTask{ Task_T(*Current), Now }; }
+            StampingIterator& operator++()      { ++Current; return *this; }
+
+            bool operator!=(const StampingIterator& other) const { return Current != other.Current; }
+        };
+
     public:
         template<typename Processor_T>
         requires std::is_same_v<std::decay_t<Processor_T>, Functor_T>
-        TaskProcessorPool(size_t numThreads, Processor_T&& processor) :
+        TaskProcessorPool(size_t numThreads, Processor_T&& processor, const char* name = "TaskPool") :
                 m_Stop          ( false                                ),
-                m_TaskProcessor ( std::forward<Processor_T>(processor) )
+                m_TaskProcessor ( std::forward<Processor_T>(processor) ),
+                m_Metrics       ( name, numThreads                     )
         {
             m_Workers.reserve(numThreads);
 
             for (size_t i = 0; i < numThreads; ++i) {
-                m_Workers.emplace_back([this] { WorkerLoop(); });
+                m_Workers.emplace_back([this, i] { WorkerLoop(i); });
             }
         }
 
@@ -51,15 +82,12 @@ namespace Mct {
         template<typename T>
         requires std::is_same_v<std::decay_t<T>, Task_T>
         bool Submit(T&& task) {
-            {
-                std::unique_lock<std::mutex> lock(m_QueueMutex);
-                if (m_Stop.load(std::memory_order_acquire)) 
-                    return false; // Pool is shutting down
-
-                m_TaskQueue.push(std::forward<T>(task));
+            if (!m_TaskQueue.Push(QueuedTask{ std::forward<T>(task), Clock_T::now() }, m_Stop)) {
+                m_Metrics.OnDropped(1);
+                return false;
             }
 
-            m_Condition.notify_one();
+            m_Metrics.OnEnqueued(1);
             return true;
         }
 
@@ -71,27 +99,21 @@ namespace Mct {
                 return !m_Stop.load(std::memory_order_acquire);
             }
 
-            {
-                std::unique_lock<std::mutex> lock(m_QueueMutex);
-                if (m_Stop.load(std::memory_order_acquire))
-                    return false; // Pool is shutting down
+            size_t pushed = 0;
 
-                if constexpr (std::is_rvalue_reference_v<Vector&&>) {
-                    // Vector is an rvalue, so we can safely MOVE elements from it
-                    for (auto& task : tasks) {
-                        m_TaskQueue.push(std::move(task));
-                    }
-                }
-                else {
-                    // Vector is an lvalue, so we must COPY elements
-                    for (const auto& task : tasks) {
-                        m_TaskQueue.push(task);
-                    }
-                }
+            if constexpr (std::is_rvalue_reference_v<Vector&&>) {
+                // Vector is an rvalue, so we can safely MOVE elements from it
+                pushed = PushStamped(std::make_move_iterator(tasks.begin()), std::make_move_iterator(tasks.end()));
+            }
+            else {
+                // Vector is an lvalue, so we must COPY elements
+                pushed = PushStamped(tasks.cbegin(), tasks.cend());
             }
 
-            m_Condition.notify_all();
-            return true;
+            // A batch cut short by shutdown still runs the part that was pushed.
+            m_Metrics.OnEnqueued(pushed);
+            m_Metrics.OnDropped(tasks.size() - pushed);
+            return pushed == tasks.size();
         }
 
         // Initiate shutdown. After this, Submit will return false.
@@ -99,50 +121,74 @@ namespace Mct {
             bool expected = false;
 
             if (m_Stop.compare_exchange_strong(expected, true)) {
-                m_Condition.notify_all();
+                m_TaskQueue.WakeAll(m_Workers.size());
             }
         }
 
+        // Call Sample() on it once per frame from the main thread.
+        [[nodiscard]] WorkerPoolMetrics& GetMetrics() noexcept { return m_Metrics; }
+
     private:
-        void WorkerLoop() {
+        template<typename It>
+        size_t PushStamped(It first, It last) {
+            const Clock_T::time_point now = Clock_T::now();
+
+            return m_TaskQueue.PushBatch(StampingIterator<It>{ first, now },
+                                         StampingIterator<It>{ last,  now },
+                                         m_Stop);
+        }
+
+        void WorkerLoop(const size_t workerIdx) {
+            const std::string threadName = std::string(m_Metrics.GetName()) + " " + std::to_string(workerIdx);
+            MCT_PROFILE_THREAD(threadName.c_str());
+
             while (true) {
-                std::unique_lock<std::mutex> lock(m_QueueMutex);
-                m_Condition.wait(lock, [this] {
-                    return m_Stop.load(std::memory_order_acquire) || !m_TaskQueue.empty();
-                });
+                std::optional<QueuedTask> nextTask = m_TaskQueue.WaitPop(m_Stop);
 
-                if (m_Stop.load(std::memory_order_acquire) && m_TaskQueue.empty()) {
+                // Only empty once shutdown was requested and every queued task is done.
+                if (!nextTask) {
                     return;
                 }
 
-                Task_T task = std::move(m_TaskQueue.front());
-                m_TaskQueue.pop();
+                Task_T task = std::move(nextTask->Task);
 
-                lock.unlock();
+                const Clock_T::time_point startTime = Clock_T::now();
+                m_Metrics.OnStarted(startTime - nextTask->EnqueueTime);
+
+                bool failed = false;
 
                 // Execute task and guard against exceptions so threads don't call std::terminate.
                 try {
+                    MCT_PROFILE_SCOPE("Task");
+
                     if constexpr (std::invocable<Functor_T, Task_T&&>)
                         m_TaskProcessor(std::move(task));
                     else
                         m_TaskProcessor(task);
                 } 
+                catch (const std::exception& e) {
+                    failed = true;
+                    MCT_ERROR("{} task failed on worker {}: {}", m_Metrics.GetName(), workerIdx, e.what());
+                }
                 catch (...) {
-                    // Swallow or log, do not rethrow, otherwise std::terminate in thread.
-                    // TODO: provide user callback/logging hook for exceptions
+                    failed = true;
+                    MCT_ERROR("{} task failed on worker {} with an unknown exception.", m_Metrics.GetName(), workerIdx);
                 }
+
+                m_Metrics.OnFinished(workerIdx, Clock_T::now() - startTime, failed);
             }
         }
 
     private:
+        using InnerQueue_T = typename Queue_T::template Rebind<QueuedTask>;
+
         std::atomic<bool>        m_Stop{ false };
         Functor_T                m_TaskProcessor;
 
-        std::queue<Task_T>       m_TaskQueue;
-        std::mutex               m_QueueMutex;
+        InnerQueue_T             m_TaskQueue;
+        WorkerPoolMetrics        m_Metrics;
 
         std::vector<std::thread> m_Workers;
-        std::condition_variable  m_Condition;
     };
 
 }
@@ -0,0 +1,205 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include "NonCopyable.h"
+#include "NonMovable.h"
+#include "MpmcQueue.h"
+
+#include <queue>
+#include <mutex>
+#include <condition_variable>
+#include <semaphore>
+#include <thread>
+#include <atomic>
+#include <optional>
+#include <type_traits>
+
+
+namespace Mct {
+
+    // Queue backends for TaskProcessorPool.
+    //
+    // A backend owns the pending tasks and the way idle workers sleep and wake up. It must provide:
+    //      bool Push(Task_T&&, const std::atomic<bool>& stop)          - false when stop is set
+    //      size_t PushBatch(It first, It last, const std::atomic<bool>&)- tasks pushed before stop, It yields Task_T&& or const Task_T&
+    //      std::optional<Task_T> WaitPop(const std::atomic<bool>& stop)- nullopt once stop is set and it is empty
+    //      void WakeAll(size_t workerCount)                            - called once after stop is set
+    //      template<typename U> using Rebind                           - same backend holding U instead
+
+
+    // std::queue under a single mutex, workers sleep on a condition variable.
+    //
+    template<typename Task_T>
+    class LockedTaskQueue : public NonCopyable, public NonMovable {
+    public:
+        template<typename U>
+        using Rebind = LockedTaskQueue<U>;
+
+    public:
+        LockedTaskQueue() = default;
+
+        template<typename T>
+        requires std::is_same_v<std::decay_t<T>, Task_T>
+        bool Push(T&& task, const std::atomic<bool>& stop) {
+            {
+                std::unique_lock<std::mutex> lock(m_QueueMutex);
+                if (stop.load(std::memory_order_acquire))
+                    return false; // Pool is shutting down
+
+                m_TaskQueue.push(std::forward<T>(task));
+            }
+
+            m_Condition.notify_one();
+            return true;
+        }
+
+        template<typename It>
+        size_t PushBatch(It first, It last, const std::atomic<bool>& stop) {
+            size_t pushed = 0;
+
+            {
+                std::unique_lock<std::mutex> lock(m_QueueMutex);
+                if (stop.load(std::memory_order_acquire))
+                    return 0; // Pool is shutting down
+
+                for (; first != last; ++first, ++pushed) {
+                    m_TaskQueue.push(*first);
+                }
+            }
+
+            m_Condition.notify_all();
+            return pushed;
+        }
+
+        std::optional<Task_T> WaitPop(const std::atomic<bool>& stop) {
+            std::unique_lock<std::mutex> lock(m_QueueMutex);
+            m_Condition.wait(lock, [this, &stop] {
+                return stop.load(std::memory_order_acquire) || !m_TaskQueue.empty();
+            });
+
+            if (m_TaskQueue.empty()) {
+                return std::nullopt; // Stopped and nothing left.
+            }
+
+            std::optional<Task_T> task(std::move(m_TaskQueue.front()));
+            m_TaskQueue.pop();
+
+            return task;
+        }
+
+        void WakeAll(size_t /*workerCount*/) {
+            {
+                std::lock_guard<std::mutex> lock(m_QueueMutex);
+            }
+
+            m_Condition.notify_all();
+        }
+
+    private:
+        std::queue<Task_T>      m_TaskQueue;
+        std::mutex              m_QueueMutex;
+        std::condition_variable m_Condition;
+    };
+
+
+    // Bounded lock-free ring (MpmcQueue) with a counting semaphore for sleeping workers.
+    //
+    // The semaphore holds one token per queued task, a whole batch is published with a single
+    // release(n) instead of n separate wakeups. Push spins (yielding) while the ring is full,
+    // which applies backpressure to producers running ahead of the workers. A batch releases the
+    // tokens of what it pushed so far before it waits, otherwise several producers could fill
+    // the ring with tasks no worker was woken for and wait on each other forever.
+    //
+    template<typename Task_T, size_t Capacity = 4096>
+    class LockFreeTaskQueue : public NonCopyable, public NonMovable {
+    public:
+        template<typename U>
+        using Rebind = LockFreeTaskQueue<U, Capacity>;
+
+    public:
+        LockFreeTaskQueue() : m_Queue(Capacity) {}
+
+        template<typename T>
+        requires std::is_same_v<std::decay_t<T>, Task_T>
+        bool Push(T&& task, const std::atomic<bool>& stop) {
+            std::ptrdiff_t unreleased = 0;
+
+            if (!PushOne(std::forward<T>(task), unreleased, stop))
+                return false;
+
+            m_Available.release();
+            return true;
+        }
+
+        // Stops at the first task refused by shutdown; the tasks pushed before it still run.
+        template<typename It>
+        size_t PushBatch(It first, It last, const std::atomic<bool>& stop) {
+            std::ptrdiff_t pushed = 0;
+
+            for (; first != last; ++first) {
+                Task_T task(*first);
+
+                if (!PushOne(std::move(task), pushed, stop))
+                    break;
+
+                ++pushed;
+            }
+
+            if (pushed > 0) {
+                m_Available.release(pushed);
+            }
+
+            return static_cast<size_t>(pushed);
+        }
+
+        std::optional<Task_T> WaitPop(const std::atomic<bool>& stop) {
+            m_Available.acquire();
+
+            while (true) {
+                if (std::optional<Task_T> task = m_Queue.TryPop())
+                    return task;
+
+                // A token without a visible task means either shutdown or a producer
+                // that claimed a slot and is still writing into it.
+                if (stop.load(std::memory_order_acquire) && m_Queue.ApproxSize() == 0)
+                    return std::nullopt;
+
+                std::this_thread::yield();
+            }
+        }
+
+        void WakeAll(size_t workerCount) {
+            m_Available.release(static_cast<std::ptrdiff_t>(workerCount));
+        }
+
+    private:
+        // unreleased counts the caller's tasks pushed without a token yet, they get theirs before
+        // waiting on a full ring so the workers can drain it.
+        template<typename T>
+        bool PushOne(T&& task, std::ptrdiff_t& unreleased, const std::atomic<bool>& stop) {
+            while (true) {
+                if (stop.load(std::memory_order_acquire))
+                    return false; // Pool is shutting down
+
+                if (m_Queue.TryPush(std::forward<T>(task)))
+                    return true;
+
+                if (unreleased > 0) {
+                    m_Available.release(unreleased);
+                    unreleased = 0;
+                }
+
+                std::this_thread::yield(); // Full, wait for the workers to catch up.
+            }
+        }
+
+    private:
+        MpmcQueue<Task_T>                 m_Queue;
+        std::counting_semaphore<>         m_Available{ 0 };
+    };
+
+}
@@ -0,0 +1,144 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#include "WorkerPoolMetrics.h"
+#include "Profiler.h"
+
+#include <algorithm>
+#include <bit>
+
+
+namespace Mct {
+
+    WorkerPoolMetrics::WorkerPoolMetrics(const char* poolName, const size_t workerCount) :
+            m_Name           ( poolName                                        ),
+            m_Workers        ( std::make_unique<WorkerCounters[]>(workerCount) ),
+            m_WorkerCount    ( workerCount                                     ),
+            m_LastSampleTime ( Clock_T::now()                                  ),
+            m_LastBusyNs     ( workerCount, 0                                  ),
+            m_PlotQueueDepth ( m_Name + "/QueueDepth"                          ),
+            m_PlotWaitP95    ( m_Name + "/WaitP95Ms"                           ),
+            m_PlotExecP95    ( m_Name + "/ExecP95Ms"                           ),
+            m_PlotBusy       ( m_Name + "/BusyPercent"                         )
+    {
+        m_Stats.WorkerBusyRatio.resize(workerCount, 0.0f);
+    }
+
+    void WorkerPoolMetrics::OnStarted(const Clock_T::duration wait) noexcept {
+        m_QueueDepth.fetch_sub(1, std::memory_order_relaxed);
+        m_WaitCounts[BucketOf(wait)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void WorkerPoolMetrics::OnFinished(const size_t workerIdx, const Clock_T::duration exec, const bool failed) noexcept {
+        const auto execNs = std::chrono::duration_cast<std::chrono::nanoseconds>(exec).count();
+
+        m_Workers[workerIdx].BusyNs.fetch_add(static_cast<uint64_t>(execNs), std::memory_order_relaxed);
+        m_ExecCounts[BucketOf(exec)].fetch_add(1, std::memory_order_relaxed);
+        m_Completed.fetch_add(1, std::memory_order_relaxed);
+
+        if (failed) {
+            m_Failed.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    bool WorkerPoolMetrics::Sample() {
+        const Clock_T::time_point now    = Clock_T::now();
+        const Clock_T::duration   window = now - m_LastSampleTime;
+
+        // The depth is always current, it is cheap and the most useful value to watch live.
+        m_Stats.QueueDepth = std::max<int64_t>(m_QueueDepth.load(std::memory_order_relaxed), 0);
+        MCT_PROFILE_VALUE(m_PlotQueueDepth.c_str(), m_Stats.QueueDepth);
+
+        if (window < c_SampleInterval)
+            return false;
+
+        const float windowSeconds = std::chrono::duration<float>(window).count();
+        const float windowNs      = windowSeconds * 1e9f;
+
+        m_Stats.WindowSeconds  = windowSeconds;
+        m_Stats.CompletedTasks = m_Completed.load(std::memory_order_relaxed);
+        m_Stats.FailedTasks    = m_Failed.load(std::memory_order_relaxed);
+        m_Stats.DroppedTasks   = m_Dropped.load(std::memory_order_relaxed);
+        m_Stats.TasksPerSecond = static_cast<float>(m_Stats.CompletedTasks - m_LastCompleted) / windowSeconds;
+
+        TakeWindow(m_WaitCounts, m_LastWaitCounts, m_Stats.WaitHistogram);
+        TakeWindow(m_ExecCounts, m_LastExecCounts, m_Stats.ExecHistogram);
+
+        m_Stats.WaitP50Ms = PercentileMs(m_Stats.WaitHistogram, 0.50f);
+        m_Stats.WaitP95Ms = PercentileMs(m_Stats.WaitHistogram, 0.95f);
+        m_Stats.WaitP99Ms = PercentileMs(m_Stats.WaitHistogram, 0.99f);
+        m_Stats.ExecP50Ms = PercentileMs(m_Stats.ExecHistogram, 0.50f);
+        m_Stats.ExecP95Ms = PercentileMs(m_Stats.ExecHistogram, 0.95f);
+        m_Stats.ExecP99Ms = PercentileMs(m_Stats.ExecHistogram, 0.99f);
+
+        float busySum = 0.0f;
+
+        for (size_t i = 0; i < m_WorkerCount; ++i) {
+            const uint64_t busyNs = m_Workers[i].BusyNs.load(std::memory_order_relaxed);
+
+            // Tasks are credited when they finish, one spanning two windows can exceed 100% in the second.
+            const float ratio = std::min(static_cast<float>(busyNs - m_LastBusyNs[i]) / windowNs, 1.0f);
+
+            m_Stats.WorkerBusyRatio[i] = ratio;
+            m_LastBusyNs[i]            = busyNs;
+            busySum                   += ratio;
+        }
+
+        m_Stats.AverageBusyRatio = m_WorkerCount > 0 ? busySum / static_cast<float>(m_WorkerCount) : 0.0f;
+
+        m_LastSampleTime = now;
+        m_LastCompleted  = m_Stats.CompletedTasks;
+
+        MCT_PROFILE_VALUE(m_PlotWaitP95.c_str(), static_cast<double>(m_Stats.WaitP95Ms));
+        MCT_PROFILE_VALUE(m_PlotExecP95.c_str(), static_cast<double>(m_Stats.ExecP95Ms));
+        MCT_PROFILE_VALUE(m_PlotBusy.c_str(),    static_cast<double>(m_Stats.AverageBusyRatio * 100.0f));
+
+        return true;
+    }
+
+    size_t WorkerPoolMetrics::BucketOf(const Clock_T::duration duration) noexcept {
+        const auto micros = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+
+        if (micros <= 0)
+            return 0;
+
+        const size_t bucket = static_cast<size_t>(std::bit_width(static_cast<uint64_t>(micros)));
+        return std::min(bucket, WorkerPoolStats::BucketCount - 1);
+    }
+
+    void WorkerPoolMetrics::TakeWindow(const AtomicHistogram_T&                            counts,
+                                       std::array<uint64_t, WorkerPoolStats::BucketCount>& previous,
+                                       WorkerPoolStats::Histogram_T&                       outWindow)
+    {
+        for (size_t i = 0; i < WorkerPoolStats::BucketCount; ++i) {
+            const uint64_t count = counts[i].load(std::memory_order_relaxed);
+
+            outWindow[i] = static_cast<uint32_t>(count - previous[i]);
+            previous[i]  = count;
+        }
+    }
+
+    float WorkerPoolMetrics::PercentileMs(const WorkerPoolStats::Histogram_T& histogram, const float percentile) noexcept {
+        uint64_t total = 0;
+        for (const uint32_t count : histogram) {
+            total += count;
+        }
+
+        if (total == 0)
+            return 0.0f;
+
+        const uint64_t target     = static_cast<uint64_t>(static_cast<float>(total) * percentile + 0.5f);
+        uint64_t       cumulative = 0;
+
+        for (size_t i = 0; i < WorkerPoolStats::BucketCount; ++i) {
+            cumulative += histogram[i];
+
+            if (cumulative >= std::max<uint64_t>(target, 1))
+                return static_cast<float>(uint64_t{ 1 } << i) / 1000.0f;
+        }
+
+        return static_cast<float>(uint64_t{ 1 } << (WorkerPoolStats::BucketCount - 1)) / 1000.0f;
+    }
+
+}
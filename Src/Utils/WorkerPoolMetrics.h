@@ -0,0 +1,126 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include "NonCopyable.h"
+#include "NonMovable.h"
+#include "CacheLine.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace Mct {
+
+    // One sampling window of a worker pool, produced by WorkerPoolMetrics::Sample().
+    struct WorkerPoolStats {
+        static constexpr size_t BucketCount = 24;
+
+        // Bucket i counts tasks which took less than 2^i microseconds (and at least 2^(i-1)).
+        using Histogram_T = std::array<uint32_t, BucketCount>;
+
+        float WindowSeconds  = 0.0f;
+        float TasksPerSecond = 0.0f;
+
+        // Enqueue to start, and start to finish. Percentiles are histogram bucket upper bounds.
+        Histogram_T WaitHistogram{};
+        Histogram_T ExecHistogram{};
+        float       WaitP50Ms = 0.0f;
+        float       WaitP95Ms = 0.0f;
+        float       WaitP99Ms = 0.0f;
+        float       ExecP50Ms = 0.0f;
+        float       ExecP95Ms = 0.0f;
+        float       ExecP99Ms = 0.0f;
+
+        // Fraction of the window each worker spent running tasks.
+        std::vector<float> WorkerBusyRatio;
+        float              AverageBusyRatio = 0.0f;
+
+        // Current and lifetime values, not limited to the window.
+        int64_t  QueueDepth     = 0;
+        uint64_t CompletedTasks = 0;
+        uint64_t FailedTasks    = 0;   // Threw an exception.
+        uint64_t DroppedTasks   = 0;   // Rejected by a stopped pool.
+    };
+
+    // Lock-free counters recorded by the workers of a pool, aggregated on the main thread.
+    //
+    // The recording side is a handful of relaxed atomic increments per task. Sample() turns the
+    // counters into windowed statistics (latency histograms, busy ratio per worker) and publishes
+    // them as profiler plots named "<pool>/<value>".
+    //
+    class WorkerPoolMetrics : public NonCopyable, public NonMovable {
+    public:
+        using Clock_T = std::chrono::steady_clock;
+
+        // Sample() keeps the previous window until at least this much time has passed.
+        static constexpr auto c_SampleInterval = std::chrono::milliseconds(500);
+
+    public:
+        WorkerPoolMetrics(const char* poolName, size_t workerCount);
+
+        // Recording, any thread.
+        void OnEnqueued(size_t count = 1) noexcept { m_QueueDepth.fetch_add(static_cast<int64_t>(count), std::memory_order_relaxed); }
+        void OnDropped(size_t count = 1)  noexcept { m_Dropped.fetch_add(count, std::memory_order_relaxed); }
+        void OnStarted(Clock_T::duration wait) noexcept;
+        void OnFinished(size_t workerIdx, Clock_T::duration exec, bool failed) noexcept;
+
+        // Main thread. Rolls the window when c_SampleInterval elapsed, returns true when it did.
+        bool Sample();
+
+        [[nodiscard]] const WorkerPoolStats& GetStats() const noexcept { return m_Stats; }
+        [[nodiscard]] const char*            GetName()  const noexcept { return m_Name.c_str(); }
+
+    private:
+        using AtomicHistogram_T = std::array<std::atomic<uint64_t>, WorkerPoolStats::BucketCount>;
+
+        struct alignas(CacheLineSize) WorkerCounters {
+            std::atomic<uint64_t> BusyNs{ 0 };
+        };
+
+        static size_t BucketOf(Clock_T::duration duration) noexcept;
+
+        static void TakeWindow(const AtomicHistogram_T&                            counts,
+                               std::array<uint64_t, WorkerPoolStats::BucketCount>& previous,
+                               WorkerPoolStats::Histogram_T&                       outWindow);
+
+        static float PercentileMs(const WorkerPoolStats::Histogram_T& histogram, float percentile) noexcept;
+
+    private:
+        std::string m_Name;
+
+        alignas(CacheLineSize) std::atomic<int64_t> m_QueueDepth{ 0 };
+        alignas(CacheLineSize) std::atomic<uint64_t> m_Completed{ 0 };
+        std::atomic<uint64_t> m_Failed{ 0 };
+        std::atomic<uint64_t> m_Dropped{ 0 };
+
+        AtomicHistogram_T m_WaitCounts{};
+        AtomicHistogram_T m_ExecCounts{};
+
+        std::unique_ptr<WorkerCounters[]> m_Workers;
+        size_t                            m_WorkerCount;
+
+        // Main thread only, state of the previous Sample().
+        Clock_T::time_point                                m_LastSampleTime;
+        uint64_t                                           m_LastCompleted = 0;
+        std::array<uint64_t, WorkerPoolStats::BucketCount> m_LastWaitCounts{};
+        std::array<uint64_t, WorkerPoolStats::BucketCount> m_LastExecCounts{};
+        std::vector<uint64_t>                              m_LastBusyNs;
+        WorkerPoolStats                                    m_Stats;
+
+        // Profiler plot names, the profiler identifies plots by pointer so they are built once.
+        std::string m_PlotQueueDepth;
+        std::string m_PlotWaitP95;
+        std::string m_PlotExecP95;
+        std::string m_PlotBusy;
+    };
+
+}
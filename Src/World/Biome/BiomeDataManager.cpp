@@ -18,9 +18,13 @@
 namespace Mct {
 
     static BiomeLayerBlendMode BiomeLayerBlendModeFromString(std::string_view blendMode);
+    static TreeType TreeTypeFromString(std::string_view treeType);
 
     static bool DecodeBiomeData(const YAML::Node& biomeNode, BiomeData& biomeData);
 
+    BiomeDataManager::BiomeLookupMap BiomeDataManager::s_LandMap;
+    BiomeDataManager::BiomeLookupMap BiomeDataManager::s_OceanMap;
+
 	bool BiomeDataManager::Init() {
         constexpr std::string_view biomeDataFilePath     = "Assets/BiomeData.yaml";
         constexpr std::string_view biomeMapLandFilePath  = "Assets/Textures/BiomeMapLand.png";
@@ -117,9 +121,10 @@ namespace Mct {
         const uint8_t* pixels = static_cast<const uint8_t*>(lut.GetData());
 
         for (size_t i = 0; i < size; ++i) {
-            const uint8_t r = pixels[i * 3 + 0];
-            const uint8_t g = pixels[i * 3 + 1];
-            const uint8_t b = pixels[i * 3 + 2];
+            // The image is loaded with 4 channels forced.
+            const uint8_t r = pixels[i * 4 + 0];
+            const uint8_t g = pixels[i * 4 + 1];
+            const uint8_t b = pixels[i * 4 + 2];
 
             const uint32_t hexColor = (r << 16) | (g << 8) | b;
 
@@ -187,7 +192,7 @@ namespace Mct {
                 BiomeTreeEntry& entry = biomeData.TreePalette.emplace_back();
 
                 std::string_view typeName = treeNode["TreeType"].Scalar();
-                //entry.Type = TreeTypeFromString(typeName);
+                entry.Type = TreeTypeFromString(typeName);
 
                 entry.Weight = treeNode["Weight"].as<uint8_t>();
             }
@@ -199,8 +204,7 @@ namespace Mct {
             for (const auto& floraNode : floraNodes) {
                 BiomeFloraEntry& entry = biomeData.FloraPalette.emplace_back();
 
-                std::string_view typeName = floraNode["FloraType"].Scalar();
-                //entry.Type = FloraTypeFromString(typeName);
+                //entry.Type = FloraTypeFromString(floraNode["FloraType"].Scalar());
 
                 entry.Weight = floraNode["Weight"].as<uint8_t>();
             }
@@ -222,4 +226,20 @@ namespace Mct {
         return None;
     }
 
+    static TreeType TreeTypeFromString(const std::string_view treeType) {
+        using enum TreeType;
+
+        if (treeType == "Oak"      ) return Oak;
+        if (treeType == "OakSwamp" ) return OakSwamp;
+        if (treeType == "Birch"    ) return Birch;
+        if (treeType == "Spruce"   ) return Spruce;
+        if (treeType == "Acacia"   ) return Acacia;
+        if (treeType == "Jungle"   ) return Jungle;
+        if (treeType == "JungleBig") return JungleBig;
+        if (treeType == "DeadBush" ) return DeadBush;
+
+        std::cerr << "Invalid TreeType: \"" << treeType << "\" provided.";
+        return Oak;
+    }
+
 }
@@ -10,6 +10,8 @@
 #include "World/Block/Block.h"
 
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 
@@ -17,8 +19,20 @@ namespace Mct {
 
     using BiomeId = uint8_t;
 
+    enum class TreeType : uint8_t {
+        Oak,
+        OakSwamp,           // Low and wide, for swamps.
+        Birch,
+        Spruce,
+        Acacia,
+        Jungle,
+        JungleBig,
+        DeadBush,           // A bare stump.
+        COUNT
+    };
+
     struct BiomeTreeEntry {
-        uint8_t Type;
+        TreeType Type;
         uint8_t Weight; // Higher number = more frequent
     };
 
@@ -108,6 +122,8 @@ namespace Mct {
             return s_BiomeData[biomeId];
         }
 
+        [[nodiscard]] static size_t GetBiomeCount() noexcept { return s_BiomeData.size(); }
+
     private:
         [[nodiscard]] static bool LoadAndBakeMap(std::string_view path,
                                                  BiomeLookupMap&  outMap, 
@@ -121,11 +137,14 @@ namespace Mct {
         // BiomeId is just the index of biome in s_BiomeData
         inline static std::unordered_map<std::string, BiomeId> s_BiomeNameToId;
 
+        // Defined in BiomeDataManager.cpp, BiomeLookupMap's member initializers aren't usable before
+        // the end of this class.
+
         // Land BiomeId lookup map from temperature-humidity.
-        inline static BiomeLookupMap s_LandMap;
+        static BiomeLookupMap s_LandMap;
 
         // Ocean BiomeId lookup map from temperature-vegetation.
-        inline static BiomeLookupMap s_OceanMap;
+        static BiomeLookupMap s_OceanMap;
     };
 
 }
@@ -87,6 +87,8 @@ namespace Mct {
             CoreBlocks::Storage::Dirt    = s_BlockNameToId[ "Dirt"    ];
             CoreBlocks::Storage::Grass   = s_BlockNameToId[ "Grass"   ];
             CoreBlocks::Storage::Water   = s_BlockNameToId[ "Water"   ];
+            CoreBlocks::Storage::Log     = s_BlockNameToId[ "Log"     ];
+            CoreBlocks::Storage::Leaves  = s_BlockNameToId[ "Leaves"  ];
         }
 	}
 
@@ -16,6 +16,7 @@
 #include <array>
 #include <string>
 #include <optional>
+#include <unordered_map>
 
 
 namespace Mct {
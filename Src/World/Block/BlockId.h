@@ -28,6 +28,8 @@ namespace Mct {
 			inline static BlockId Dirt    = 0;
 			inline static BlockId Grass   = 0;
 			inline static BlockId Water   = 0;
+			inline static BlockId Log     = 0;
+			inline static BlockId Leaves  = 0;
 		};
 
 	public:
@@ -39,6 +41,8 @@ namespace Mct {
 		inline static const BlockId& Dirt    = Storage::Dirt;
 		inline static const BlockId& Grass   = Storage::Grass;
 		inline static const BlockId& Water   = Storage::Water;
+		inline static const BlockId& Log     = Storage::Log;
+		inline static const BlockId& Leaves  = Storage::Leaves;
 
 		CoreBlocks() = delete;
 	};
@@ -7,11 +7,13 @@
 #pragma once
 
 
+#include "World/Block/Block.h"
 #include "ChunkSpan.h"
 #include "World/WorldConstants.h"
 #include "Utils/Assert.h"
 
 #include <array>
+#include <span>
 
 
 namespace Mct {
@@ -33,6 +35,10 @@ namespace Mct {
             return { &m_Data[Internal::ChunkLayout::SubchunkOffset(subchunkIdx)] };
         }
 
+        // Every block in memory order, for bulk copies which don't care about the layout.
+        [[nodiscard]] constexpr std::span<Block>       GetRawForWrite()       noexcept { return m_Data; }
+        [[nodiscard]] constexpr std::span<const Block> GetRaw()         const noexcept { return m_Data; }
+
     private:
         std::array<Block, WorldConst::ChunkBlockCount> m_Data;
     };
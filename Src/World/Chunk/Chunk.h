@@ -12,11 +12,15 @@
 #include "BlockStorage.h"
 #include "ChunkMesh.h"
 #include "ChunkGpuMesh.h"
+#include "ChunkTimeline.h"
+#include "ChunkHeightmaps.h"
+#include "TreeAnchor.h"
 
 #include <glm/glm.hpp>
 
 #include <span>
 #include <memory>
+#include <vector>
 
 
 namespace Mct {
@@ -33,14 +37,16 @@ namespace Mct {
 				m_Coord  ( coord                            ),
 				m_Blocks ( std::make_unique<BlockStorage>() )
 		{
-			m_Subchunks.reserve(WorldConst::SubchunkCount);
-
-			glm::vec3 subchunkPos = m_Coord.ToBlockCoordFloat();
+			CreateSubchunks();
+		}
 
-			for (size_t i = 0; i < WorldConst::SubchunkCount; ++i) {
-				m_Subchunks.emplace_back(subchunkPos, m_Blocks->GetSubchunkForWrite(i));
-				subchunkPos.y += static_cast<float>(static_cast<int>(WorldConst::SubchunkSizeY));
-			}
+		// Takes over already filled blocks, used to reinstate cached chunks.
+		Chunk(ChunkCoord coord, std::unique_ptr<BlockStorage> blocks) :
+				m_Coord  ( coord             ),
+				m_Blocks ( std::move(blocks) )
+		{
+			CreateSubchunks();
+			m_Heightmaps.Rebuild(*m_Blocks);
 		}
 
 		[[nodiscard]] ChunkCoord GetCoord() const noexcept { return m_Coord; }
@@ -48,6 +54,25 @@ namespace Mct {
 		[[nodiscard]] ChunkSpan<const Block> GetBlocks() const noexcept { return { m_Blocks->ViewForRead()  }; }
 		[[nodiscard]] ChunkSpan<Block> GetBlocksForWrite()     noexcept { return { m_Blocks->ViewForWrite() }; }
 
+		[[nodiscard]] const BlockStorage& GetBlockStorage() const noexcept { return *m_Blocks; }
+
+		// Generators writing through GetBlocksForWrite fill the heightmaps themselves.
+		[[nodiscard]] const ChunkHeightmaps& GetHeightmaps() const noexcept { return m_Heightmaps; }
+		[[nodiscard]] ChunkHeightmaps& GetHeightmapsForWrite()     noexcept { return m_Heightmaps; }
+
+		[[nodiscard]] Block GetBlock(size_t x, size_t y, size_t z) const noexcept { return GetBlocks()(x, y, z); }
+
+		// Single block edit, keeps the heightmaps current. The mesh isn't rebuilt.
+		void SetBlock(size_t x, size_t y, size_t z, Block block) noexcept {
+			GetBlocksForWrite()(x, y, z) = block;
+			m_Heightmaps.OnBlockChanged(GetBlocks(), x, y, z, block);
+		}
+
+		// Trees rooted in this chunk, set by the terrain generator. Their canopies may reach into the
+		// neighbors, whose decoration reads them as well, so they don't change after generation.
+		[[nodiscard]] std::span<const TreeAnchor> GetTreeAnchors() const noexcept { return m_TreeAnchors; }
+		void SetTreeAnchors(std::vector<TreeAnchor> anchors) noexcept { m_TreeAnchors = std::move(anchors); }
+
 		[[nodiscard]] std::span<const Subchunk> GetSubchunks() const noexcept { return m_Subchunks; }
 		[[nodiscard]] std::span<Subchunk> GetSubchunksForWrite()     noexcept { return m_Subchunks; }
 
@@ -65,20 +90,51 @@ namespace Mct {
 			}
 		}
 
+		// Detaches the uploaded mesh (nullptr when there is none) and drops a mesh still waiting
+		// for upload, the chunk needs a new mesh afterwards.
+		std::unique_ptr<ChunkGpuMesh> TakeGpuMesh() noexcept {
+			for (Subchunk& subchunk : m_Subchunks) {
+				subchunk.SetMesh(nullptr);
+			}
+
+			m_CpuMesh.reset();
+			m_MeshState = MeshState::NoMesh;
+			return std::move(m_GpuMesh);
+		}
+
 		void SetMesh(std::unique_ptr<ChunkMesh> cpuMesh) {
 			m_CpuMesh   = std::move(cpuMesh);
 			m_MeshState = MeshState::DirtyMesh;
 		}
 
+		[[nodiscard]] const ChunkTimeline& GetTimeline() const noexcept { return m_Timeline; }
+		[[nodiscard]] ChunkTimeline& GetTimeline()             noexcept { return m_Timeline; }
+
+	private:
+		void CreateSubchunks() {
+			m_Subchunks.reserve(WorldConst::SubchunkCount);
+
+			glm::vec3 subchunkPos = m_Coord.ToBlockCoordFloat();
+
+			for (size_t i = 0; i < WorldConst::SubchunkCount; ++i) {
+				m_Subchunks.emplace_back(subchunkPos, m_Blocks->GetSubchunkForWrite(i));
+				subchunkPos.y += static_cast<float>(static_cast<int>(WorldConst::SubchunkSizeY));
+			}
+		}
+
 	private:
 		ChunkCoord                    m_Coord;
 		std::unique_ptr<BlockStorage> m_Blocks;
 		std::vector<Subchunk>         m_Subchunks;
+		ChunkHeightmaps               m_Heightmaps;
+		std::vector<TreeAnchor>       m_TreeAnchors;
 
 		MeshState m_MeshState = MeshState::NoMesh;
 
 		std::unique_ptr<ChunkMesh>    m_CpuMesh;
 		std::unique_ptr<ChunkGpuMesh> m_GpuMesh;
+
+		ChunkTimeline m_Timeline;
 	};
 
 }
@@ -0,0 +1,99 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#include "ChunkHeightmaps.h"
+
+#include <algorithm>
+
+
+namespace Mct {
+
+    bool ChunkHeightmaps::Matches(const HeightmapType type, const Block block) noexcept {
+        switch (type) {
+            case HeightmapType::WorldSurface:   return block.GetType() != CoreBlocks::Air;
+            case HeightmapType::OpaqueTop:      return block.IsSolid() && !block.IsWater();
+            case HeightmapType::MotionBlocking: return block.IsSolid() || block.IsWater();
+            case HeightmapType::COUNT:          break;
+        }
+
+        return false;
+    }
+
+    void ChunkHeightmaps::RebuildColumn(const ChunkSpan<const Block> blocks, const size_t x, const size_t z, const size_t fromY) noexcept {
+        const size_t column = ColumnIndex(x, z);
+        size_t       found  = 0;
+
+        for (auto& heights : m_Heights) {
+            heights[column] = 0;
+        }
+
+        // The heightmaps nest (opaque and motion blocking tops are never above the surface), one
+        // pass down the column finds all of them.
+        for (size_t y = fromY + 1; y-- > 0 && found < c_TypeCount; ) {
+            const Block block = blocks(x, y, z);
+
+            if (block.GetType() == CoreBlocks::Air)
+                continue;
+
+            for (size_t type = 0; type < c_TypeCount; ++type) {
+                if (m_Heights[type][column] == 0 && Matches(static_cast<HeightmapType>(type), block)) {
+                    m_Heights[type][column] = static_cast<uint16_t>(y + 1);
+                    ++found;
+                }
+            }
+        }
+    }
+
+    void ChunkHeightmaps::Rebuild(const BlockStorage& storage) noexcept {
+        const std::span<const Block> raw = storage.GetRaw();
+
+        // Top of the highest subchunk holding anything but air, subchunks are contiguous in memory.
+        size_t fromY = 0;
+
+        for (size_t subchunk = WorldConst::SubchunkCount; subchunk-- > 0; ) {
+            const auto begin = raw.begin() + static_cast<std::ptrdiff_t>(Internal::ChunkLayout::SubchunkOffset(subchunk));
+            const auto end   = begin + static_cast<std::ptrdiff_t>(WorldConst::SubchunkBlockCount);
+
+            if (!std::all_of(begin, end, [](const Block& block) { return block.GetType() == CoreBlocks::Air; })) {
+                fromY = (subchunk + 1) * WorldConst::SubchunkSizeY - 1;
+                break;
+            }
+        }
+
+        for (size_t x = 0; x < WorldConst::ChunkSizeX; ++x) {
+            for (size_t z = 0; z < WorldConst::ChunkSizeZ; ++z) {
+                RebuildColumn(storage.ViewForRead(), x, z, fromY);
+            }
+        }
+    }
+
+    void ChunkHeightmaps::OnBlockChanged(const ChunkSpan<const Block> blocks, const size_t x, const size_t y, const size_t z,
+                                         const Block block) noexcept {
+        const size_t   column = ColumnIndex(x, z);
+        const uint16_t above  = static_cast<uint16_t>(y + 1);
+
+        for (size_t type = 0; type < c_TypeCount; ++type) {
+            uint16_t& height = m_Heights[type][column];
+
+            if (Matches(static_cast<HeightmapType>(type), block)) {
+                height = std::max(height, above);
+                continue;
+            }
+
+            if (height != above)
+                continue;
+
+            // The top was removed, the next matching block below becomes the top.
+            height = 0;
+
+            for (size_t below = y; below-- > 0; ) {
+                if (Matches(static_cast<HeightmapType>(type), blocks(x, below, z))) {
+                    height = static_cast<uint16_t>(below + 1);
+                    break;
+                }
+            }
+        }
+    }
+
+}
@@ -0,0 +1,68 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include "BlockStorage.h"
+#include "ChunkSpan.h"
+#include "World/Block/Block.h"
+#include "World/WorldConstants.h"
+
+#include <array>
+#include <cstdint>
+
+
+namespace Mct {
+
+    enum class HeightmapType : uint8_t {
+        WorldSurface,       // Any block but air.
+        OpaqueTop,          // Solid blocks light can't pass, water excluded.
+        MotionBlocking,     // Solid blocks and water.
+        COUNT
+    };
+
+    // Top block of every column of a chunk, one heightmap per HeightmapType.
+    //
+    // Heights are one above the top matching block, 0 for a column without any, so they fit the
+    // ChunkSizeY + 1 possible values. Generators fill them with the blocks and Chunk::SetBlock keeps
+    // them current, readers get the surface in O(columns) instead of scanning whole columns.
+    //
+    class ChunkHeightmaps {
+    public:
+        [[nodiscard]] static bool Matches(HeightmapType type, Block block) noexcept;
+
+        [[nodiscard]] uint16_t Get(const HeightmapType type, const size_t x, const size_t z) const noexcept {
+            return m_Heights[static_cast<size_t>(type)][ColumnIndex(x, z)];
+        }
+
+        void Set(const HeightmapType type, const size_t x, const size_t z, const uint16_t height) noexcept {
+            MCT_ASSERT(height <= WorldConst::ChunkSizeY);
+            m_Heights[static_cast<size_t>(type)][ColumnIndex(x, z)] = height;
+        }
+
+        // Scans the column down from fromY, the blocks above it have to be air.
+        void RebuildColumn(ChunkSpan<const Block> blocks, size_t x, size_t z, size_t fromY = WorldConst::ChunkSizeY - 1) noexcept;
+
+        // Every column, skipping the all air subchunks at the top.
+        void Rebuild(const BlockStorage& storage) noexcept;
+
+        // After blocks(x, y, z) was set to block. Only removing a column's top block scans downwards.
+        void OnBlockChanged(ChunkSpan<const Block> blocks, size_t x, size_t y, size_t z, Block block) noexcept;
+
+    private:
+        static constexpr size_t c_TypeCount = static_cast<size_t>(HeightmapType::COUNT);
+
+        [[nodiscard]] static constexpr size_t ColumnIndex(const size_t x, const size_t z) noexcept {
+            MCT_ASSERT(x < WorldConst::ChunkSizeX && z < WorldConst::ChunkSizeZ);
+            return x * WorldConst::ChunkSizeZ + z;
+        }
+
+        static_assert(WorldConst::ChunkSizeY < UINT16_MAX);
+
+    private:
+        std::array<std::array<uint16_t, WorldConst::ChunkSizeX * WorldConst::ChunkSizeZ>, c_TypeCount> m_Heights{};
+    };
+
+}
@@ -22,7 +22,7 @@ namespace Mct {
     };
 
     struct ChunkMesh {
-        std::array<SubchunkMesh, WorldConst::SubchunkCount> SubchunkMesh;
+        std::array<Mct::SubchunkMesh, WorldConst::SubchunkCount> SubchunkMesh;
     };
 
 }
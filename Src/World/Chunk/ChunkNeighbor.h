@@ -10,6 +10,7 @@
 #include "ChunkSpan.h"
 #include "Chunk.h"
 
+#include <array>
 #include <memory>
 
 
@@ -81,6 +82,18 @@ namespace Mct {
         std::shared_ptr<const Chunk> m_WestPtr;
     };
 
+    // A chunk to decorate with the eight chunks around it, all generated.
+    struct ChunkDecorationInput {
+        static constexpr std::array<ChunkCoord, 8> c_NeighborOffsets{ {
+            { -1, -1 }, { 0, -1 }, { +1, -1 },
+            { -1,  0 },            { +1,  0 },
+            { -1, +1 }, { 0, +1 }, { +1, +1 }
+        } };
+
+        std::shared_ptr<Chunk>                      Main;
+        std::array<std::shared_ptr<const Chunk>, 8> Neighbors;   // At Main + c_NeighborOffsets[i].
+    };
+
     struct ChunkMeshInputView {
         const ChunkSpan<const Block> Main;
         const ChunkSpan<const Block> North;
@@ -12,6 +12,8 @@
 
 #include <QkTraits/FunctionTraits.h>
 
+#include <algorithm>
+
 
 namespace Mct {
 
@@ -188,6 +190,14 @@ namespace Mct {
         [[nodiscard]] constexpr size_t SizeY() const noexcept { return WorldConst::SubchunkSizeY; }
         [[nodiscard]] constexpr size_t SizeZ() const noexcept { return WorldConst::SubchunkSizeZ; }
 
+        // The blocks of a subchunk are contiguous, a uniform one is written in one go.
+        constexpr void Fill(const T& value) noexcept
+            requires (!std::is_const_v<T>)
+        {
+            MCT_ASSERT(m_Data != nullptr);
+            std::fill_n(m_Data, WorldConst::SubchunkBlockCount, value);
+        }
+
         template<typename Fun>
         constexpr void ForEachXYZ(Fun&& fun)
                 noexcept(std::is_nothrow_invocable_v<Fun,
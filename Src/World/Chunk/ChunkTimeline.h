@@ -0,0 +1,65 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+
+namespace Mct {
+
+    // Points in the life of a chunk, in the order a chunk passes them.
+    enum class ChunkLifecycleStage : uint8_t {
+        Requested,          // Entered the load range, terrain job submitted.
+        GenerationStart,
+        GenerationEnd,
+        Decorated,          // Trees grown, after the eight neighbors were generated.
+        MeshStart,          // All five mesh inputs were decorated and a worker picked the mesh job.
+        MeshEnd,
+        Uploaded,           // GPU buffers written by the renderer.
+        FirstDrawn,         // Part of a frame's draw commands for the first time.
+        COUNT
+    };
+
+    // Timestamps of one chunk's lifecycle stages.
+    //
+    // Each stage is stamped by exactly one thread, and the stamps reach the readers through the same
+    // channels that hand the chunk from stage to stage, so no synchronization is needed here.
+    //
+    struct ChunkTimeline {
+        using Clock_T = std::chrono::steady_clock;
+
+        std::array<Clock_T::time_point, static_cast<size_t>(ChunkLifecycleStage::COUNT)> Stamps{};
+
+        // Chunks generated together by one terrain job, they all share its generation stamps.
+        uint32_t GenerationBatch = 1;
+
+        void Stamp(ChunkLifecycleStage stage, Clock_T::time_point time = Clock_T::now()) noexcept {
+            Stamps[static_cast<size_t>(stage)] = time;
+        }
+
+        [[nodiscard]] bool Has(ChunkLifecycleStage stage) const noexcept {
+            return Stamps[static_cast<size_t>(stage)] != Clock_T::time_point{};
+        }
+
+        // Every stage up to last was stamped. Chunks reinstated from the ChunkCache start with an empty
+        // timeline, remeshing one stamps only the mesh stages.
+        [[nodiscard]] bool HasThrough(ChunkLifecycleStage last) const noexcept {
+            for (size_t stage = 0; stage <= static_cast<size_t>(last); ++stage) {
+                if (Stamps[stage] == Clock_T::time_point{})
+                    return false;
+            }
+
+            return true;
+        }
+
+        [[nodiscard]] Clock_T::time_point Get(ChunkLifecycleStage stage) const noexcept {
+            return Stamps[static_cast<size_t>(stage)];
+        }
+    };
+
+}
@@ -0,0 +1,49 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#include "CompressedBlocks.h"
+
+#include <algorithm>
+#include <limits>
+
+
+namespace Mct {
+
+    CompressedBlocks CompressedBlocks::Compress(const BlockStorage& storage) {
+        constexpr size_t MaxRunLength = std::numeric_limits<uint16_t>::max();
+
+        const std::span<const Block> blocks = storage.GetRaw();
+
+        CompressedBlocks compressed;
+
+        for (size_t i = 0; i < blocks.size(); ) {
+            const BlockId type = blocks[i].GetType();
+            size_t        end  = i + 1;
+
+            while (end < blocks.size() && end - i < MaxRunLength && blocks[end].GetType() == type) {
+                ++end;
+            }
+
+            compressed.m_Runs.push_back(Run{ type, static_cast<uint16_t>(end - i) });
+            i = end;
+        }
+
+        // Kept around for a while, don't hold on to the growth slack.
+        compressed.m_Runs.shrink_to_fit();
+        return compressed;
+    }
+
+    void CompressedBlocks::DecompressInto(BlockStorage& storage) const noexcept {
+        const std::span<Block> blocks = storage.GetRawForWrite();
+
+        auto out = blocks.begin();
+
+        for (const Run run : m_Runs) {
+            out = std::fill_n(out, run.Length, Block(run.Type));
+        }
+
+        MCT_ASSERT(out == blocks.end(), "Compressed blocks don't cover the whole chunk");
+    }
+
+}
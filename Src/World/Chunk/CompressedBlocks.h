@@ -0,0 +1,46 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include "BlockStorage.h"
+#include "World/Block/BlockId.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+
+namespace Mct {
+
+    // Run length encoded copy of a chunk's blocks.
+    //
+    // Generated terrain is mostly long runs of air and stone along the memory order, a typical
+    // chunk shrinks from ~192 KiB to a few KiB.
+    //
+    class CompressedBlocks {
+    public:
+        struct Run {
+            BlockId  Type;
+            uint16_t Length;
+        };
+
+    public:
+        CompressedBlocks() = default;
+
+        [[nodiscard]] static CompressedBlocks Compress(const BlockStorage& storage);
+
+        void DecompressInto(BlockStorage& storage) const noexcept;
+
+        [[nodiscard]] size_t GetByteSize() const noexcept { return m_Runs.capacity() * sizeof(Run); }
+
+        // In BlockStorage memory order.
+        [[nodiscard]] std::span<const Run> GetRuns() const noexcept { return m_Runs; }
+
+    private:
+        std::vector<Run> m_Runs;
+    };
+
+}
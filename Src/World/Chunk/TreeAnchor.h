@@ -0,0 +1,24 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include "World/Biome/BiomeDataManager.h"
+
+#include <cstdint>
+
+
+namespace Mct {
+
+    // Base of a tree, picked by the terrain generator and grown by the decoration stage.
+    struct TreeAnchor {
+        uint8_t  X;         // In the chunk.
+        uint8_t  Z;
+        uint16_t Y;         // First block above the ground.
+        TreeType Type;
+        uint8_t  Variant;   // Random bits for the tree's size.
+    };
+
+}
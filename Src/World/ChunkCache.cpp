@@ -0,0 +1,145 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#include "ChunkCache.h"
+#include "Utils/Profiler.h"
+
+
+namespace Mct {
+
+    ChunkCache::ChunkCache(DeferredReclaimer& reclaimer, const ChunkCacheBudget budget) :
+            m_Reclaimer ( reclaimer ),
+            m_Budget    ( budget    )
+    {}
+
+    void ChunkCache::Insert(const Chunk& chunk) {
+        MCT_PROFILE_FUNCTION();
+
+        const ChunkCoord coord = chunk.GetCoord();
+
+        // Can't normally happen, a cached coord is taken out before it gets loaded again.
+        if (auto it = m_Index.find(coord); it != m_Index.end()) {
+            Remove(it->second);
+        }
+
+        Entry& entry = m_Entries.emplace_front();
+        entry.Coord  = coord;
+        entry.Source = &chunk;
+        entry.Blocks = CompressedBlocks::Compress(chunk.GetBlockStorage());
+
+        const std::span<const TreeAnchor> anchors = chunk.GetTreeAnchors();
+        entry.TreeAnchors.assign(anchors.begin(), anchors.end());
+
+        m_Index.emplace(coord, m_Entries.begin());
+
+        ++m_Stats.Entries;
+        m_Stats.CompressedBytes += entry.Blocks.GetByteSize();
+
+        EnforceBudget();
+    }
+
+    void ChunkCache::AttachGpuMesh(const Chunk& source, std::unique_ptr<ChunkGpuMesh> mesh) {
+        auto it = m_Index.find(source.GetCoord());
+
+        if (it == m_Index.end() || it->second->Source != &source || it->second->GpuMesh) {
+            m_Reclaimer.Retire(std::move(mesh));
+            return;
+        }
+
+        Entry& entry   = *it->second;
+        entry.GpuMesh  = std::move(mesh);
+        entry.GpuBytes = GpuByteSize(*entry.GpuMesh);
+
+        ++m_Stats.EntriesWithMesh;
+        m_Stats.GpuBytes += entry.GpuBytes;
+
+        EnforceBudget();
+    }
+
+    std::shared_ptr<Chunk> ChunkCache::TryTake(const ChunkCoord coord) {
+        auto indexIt = m_Index.find(coord);
+
+        if (indexIt == m_Index.end()) {
+            ++m_Stats.Misses;
+            return nullptr;
+        }
+
+        ++m_Stats.Hits;
+
+        Entry& entry = *indexIt->second;
+
+        auto blocks = std::make_unique<BlockStorage>();
+        entry.Blocks.DecompressInto(*blocks);
+
+        auto chunk = std::make_shared<Chunk>(coord, std::move(blocks));
+        chunk->SetTreeAnchors(std::move(entry.TreeAnchors));
+
+        if (entry.GpuMesh) {
+            --m_Stats.EntriesWithMesh;
+            m_Stats.GpuBytes -= entry.GpuBytes;
+            entry.GpuBytes    = 0;
+
+            chunk->SetGpuMesh(std::move(entry.GpuMesh));
+        }
+
+        Remove(indexIt->second);
+        return chunk;
+    }
+
+    size_t ChunkCache::GpuByteSize(const ChunkGpuMesh& mesh) noexcept {
+        size_t bytes = 0;
+
+        auto addHandle = [&bytes](const std::optional<GpuMeshHandle>& handle) {
+            if (!handle)
+                return;
+
+            bytes += handle->VboHandle.GetSize();
+            bytes += handle->IboHandle ? handle->IboHandle->GetSize() : 0;
+        };
+
+        for (const SubchunkGpuMesh& subchunkMesh : mesh.SubchunkMeshes) {
+            addHandle(subchunkMesh.SolidMesh);
+            addHandle(subchunkMesh.WaterMesh);
+        }
+
+        return bytes;
+    }
+
+    void ChunkCache::Remove(const EntryList_T::iterator it) {
+        --m_Stats.Entries;
+        m_Stats.CompressedBytes -= it->Blocks.GetByteSize();
+        m_Stats.GpuBytes        -= it->GpuBytes;
+
+        if (it->GpuMesh) {
+            --m_Stats.EntriesWithMesh;
+            m_Reclaimer.Retire(std::move(it->GpuMesh));
+        }
+
+        m_Index.erase(it->Coord);
+        m_Entries.erase(it);
+    }
+
+    void ChunkCache::EnforceBudget() {
+        // Meshes first, the GPU buffers are shared with the visible chunks. Their handles reach
+        // the MeshManager's deletion queue from the reclaim job.
+        for (auto it = m_Entries.rbegin(); it != m_Entries.rend() && m_Stats.GpuBytes > m_Budget.GpuBytes; ++it) {
+            if (!it->GpuMesh)
+                continue;
+
+            m_Stats.GpuBytes -= it->GpuBytes;
+            --m_Stats.EntriesWithMesh;
+
+            m_Reclaimer.Retire(std::move(it->GpuMesh));
+            it->GpuBytes = 0;
+        }
+
+        while (!m_Entries.empty() && m_Stats.CompressedBytes > m_Budget.CompressedBytes) {
+            Remove(std::prev(m_Entries.end()));
+            ++m_Stats.Evictions;
+        }
+
+        MCT_PROFILE_VALUE("ChunkCacheEntries", static_cast<double>(m_Stats.Entries));
+    }
+
+}
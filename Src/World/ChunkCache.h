@@ -0,0 +1,93 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include "Chunk/Chunk.h"
+#include "Chunk/CompressedBlocks.h"
+#include "Utils/NonCopyable.h"
+#include "Utils/DeferredReclaimer.h"
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+
+namespace Mct {
+
+    struct ChunkCacheBudget {
+        size_t CompressedBytes = 64 * 1024 * 1024;   // 64 MiB of compressed blocks.
+        size_t GpuBytes        = 48 * 1024 * 1024;   // Vertex + index bytes kept allocated in the MeshManager.
+    };
+
+    struct ChunkCacheStats {
+        size_t   Entries         = 0;
+        size_t   EntriesWithMesh = 0;
+        size_t   CompressedBytes = 0;
+        size_t   GpuBytes        = 0;
+        uint64_t Hits            = 0;
+        uint64_t Misses          = 0;
+        uint64_t Evictions       = 0;   // Entries dropped entirely, meshes dropped alone don't count.
+    };
+
+    // LRU cache of recently unloaded chunks, so walking back over a load boundary reinstates
+    // chunks instead of regenerating, remeshing and re-uploading them.
+    //
+    // Entries keep the blocks run length compressed along with the chunk's GPU mesh allocations.
+    // Over the GPU budget the least recently unloaded entries lose their mesh first (they get
+    // remeshed on reinstatement), over the compressed budget they are dropped entirely.
+    //
+    // Streaming thread only. GPU meshes are owned by the main thread while the chunk is loaded,
+    // they join the entry of an unloaded chunk once the main thread handed them back.
+    //
+    class ChunkCache : public NonCopyable {
+    public:
+        // Meshes dropped over budget are destroyed through reclaimer.
+        explicit ChunkCache(DeferredReclaimer& reclaimer, ChunkCacheBudget budget = {});
+
+        // Compresses the blocks of a chunk being unloaded.
+        void Insert(const Chunk& chunk);
+
+        // Adds the GPU mesh the main thread took from source to the entry made from it. Dropped
+        // when that entry is gone (evicted, or reinstated in the meantime).
+        void AttachGpuMesh(const Chunk& source, std::unique_ptr<ChunkGpuMesh> mesh);
+
+        // Rebuilds the chunk and removes it from the cache, nullptr when it is not cached.
+        // The chunk comes back meshed when its GPU mesh survived.
+        [[nodiscard]] std::shared_ptr<Chunk> TryTake(ChunkCoord coord);
+
+        [[nodiscard]] const ChunkCacheStats& GetStats() const noexcept { return m_Stats; }
+
+    private:
+        struct Entry {
+            ChunkCoord                    Coord;
+            const Chunk*                  Source = nullptr;   // Identity only, never dereferenced.
+            CompressedBlocks              Blocks;
+            std::vector<TreeAnchor>       TreeAnchors;        // Neighbors decorated later still need them.
+            std::unique_ptr<ChunkGpuMesh> GpuMesh;
+            size_t                        GpuBytes = 0;
+        };
+
+        using EntryList_T = std::list<Entry>;
+
+    private:
+        static size_t GpuByteSize(const ChunkGpuMesh& mesh) noexcept;
+
+        void Remove(EntryList_T::iterator it);
+        void EnforceBudget();
+
+    private:
+        DeferredReclaimer& m_Reclaimer;
+        ChunkCacheBudget   m_Budget;
+        ChunkCacheStats    m_Stats;
+
+        // Most recently unloaded at the front.
+        EntryList_T                                           m_Entries;
+        std::unordered_map<ChunkCoord, EntryList_T::iterator> m_Index;
+    };
+
+}
@@ -0,0 +1,207 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#include "ChunkDependencyGraph.h"
+
+
+namespace Mct {
+
+    void ChunkDependencyGraph::Track(const std::span<const ChunkCoord> newChunks) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        TrackLocked(newChunks);
+    }
+
+    void ChunkDependencyGraph::Untrack(const std::span<const ChunkCoord> chunks, std::vector<std::shared_ptr<Chunk>>& outDropped) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        for (const ChunkCoord coord : chunks) {
+            auto it = m_Nodes.find(coord);
+            if (it == m_Nodes.end())
+                continue;
+
+            Node& node = it->second;
+
+            if (node.Generated) {
+                for (const ChunkCoord offset : ChunkDecorationInput::c_NeighborOffsets) {
+                    if (Node* neighbor = FindLocked({ coord.X + offset.X, coord.Z + offset.Z })) {
+                        ++neighbor->MissingTerrain;
+                    }
+                }
+            }
+
+            if (node.Decorated) {
+                for (const ChunkCoord offset : c_NeighborOffsets) {
+                    if (Node* neighbor = FindLocked({ coord.X + offset.X, coord.Z + offset.Z })) {
+                        ++neighbor->MissingInputs;
+                    }
+                }
+            }
+
+            if (node.Generated && !node.Decorated) {
+                outDropped.push_back(std::move(node.Generated));
+            }
+
+            m_Nodes.erase(it);
+        }
+    }
+
+    void ChunkDependencyGraph::OnTerrainGenerated(const std::shared_ptr<Chunk>& chunk, std::vector<ChunkDecorationInput>& outDecorations) {
+        const ChunkCoord coord = chunk->GetCoord();
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        Node* node = FindLocked(coord);
+
+        // Unloaded while generating, or a stale duplicate of a chunk which was re-requested.
+        if (!node || node->Generated)
+            return;
+
+        MarkGeneratedLocked(*node, chunk, outDecorations);
+    }
+
+    bool ChunkDependencyGraph::OnDecorated(const std::shared_ptr<Chunk>& chunk, std::vector<ReadyMesh>& outReady) {
+        const ChunkCoord coord = chunk->GetCoord();
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        Node* node = FindLocked(coord);
+
+        if (!node || node->Generated != chunk || node->Decorated)
+            return false;
+
+        MarkDecoratedLocked(coord, *node, outReady);
+        return true;
+    }
+
+    void ChunkDependencyGraph::Reinstate(const std::shared_ptr<Chunk>& chunk, const bool meshed,
+                                         std::vector<ChunkDecorationInput>& outDecorations, std::vector<ReadyMesh>& outReady) {
+        const ChunkCoord coords[] = { chunk->GetCoord() };
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        TrackLocked(coords);
+
+        Node& node = *FindLocked(coords[0]);
+        if (node.Generated)
+            return;
+
+        // Cached chunks were decorated before they were unloaded, they never get decorated twice.
+        node.DecorationScheduled = true;
+        node.MeshScheduled       = meshed;
+
+        MarkGeneratedLocked(node, chunk, outDecorations);
+        MarkDecoratedLocked(coords[0], node, outReady);
+    }
+
+    bool ChunkDependencyGraph::IsCurrent(const std::shared_ptr<Chunk>& chunk) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        const Node* node = FindLocked(chunk->GetCoord());
+        return node && node->Generated == chunk;
+    }
+
+    void ChunkDependencyGraph::TrackLocked(const std::span<const ChunkCoord> newChunks) {
+        const Clock_T::time_point now = Clock_T::now();
+
+        for (const ChunkCoord coord : newChunks) {
+            auto [it, inserted] = m_Nodes.try_emplace(coord);
+            if (!inserted)
+                continue;
+
+            Node& node = it->second;
+            node.RequestTime = now;
+
+            // Neighbors generated or decorated before this chunk was requested already count as present.
+            for (const ChunkCoord offset : ChunkDecorationInput::c_NeighborOffsets) {
+                const Node* neighbor = FindLocked({ coord.X + offset.X, coord.Z + offset.Z });
+
+                if (neighbor && neighbor->Generated) {
+                    --node.MissingTerrain;
+                }
+            }
+
+            for (const ChunkCoord offset : c_NeighborOffsets) {
+                const Node* neighbor = FindLocked({ coord.X + offset.X, coord.Z + offset.Z });
+
+                if (neighbor && neighbor->Decorated) {
+                    --node.MissingInputs;
+                }
+            }
+        }
+    }
+
+    void ChunkDependencyGraph::TryDecorateLocked(const ChunkCoord coord, Node& node, std::vector<ChunkDecorationInput>& outDecorations) {
+        if (node.MissingTerrain != 0 || node.DecorationScheduled)
+            return;
+
+        node.DecorationScheduled = true;
+
+        // MissingTerrain == 0 guarantees all eight neighbors are tracked and generated.
+        ChunkDecorationInput& input = outDecorations.emplace_back();
+        input.Main = node.Generated;
+
+        for (size_t i = 0; i < input.Neighbors.size(); ++i) {
+            const ChunkCoord offset = ChunkDecorationInput::c_NeighborOffsets[i];
+            input.Neighbors[i] = FindLocked({ coord.X + offset.X, coord.Z + offset.Z })->Generated;
+        }
+    }
+
+    void ChunkDependencyGraph::TryScheduleLocked(const ChunkCoord coord, Node& node, std::vector<ReadyMesh>& outReady) {
+        if (node.MissingInputs != 0 || !node.WantsMesh || node.MeshScheduled)
+            return;
+
+        node.MeshScheduled = true;
+
+        // MissingInputs == 0 guarantees all four neighbors are tracked and decorated.
+        outReady.push_back(ReadyMesh{
+            .Input {
+                node.Generated,
+                FindLocked({ coord.X,     coord.Z - 1 })->Generated,
+                FindLocked({ coord.X,     coord.Z + 1 })->Generated,
+                FindLocked({ coord.X + 1, coord.Z     })->Generated,
+                FindLocked({ coord.X - 1, coord.Z     })->Generated
+            },
+            .RequestTime { node.RequestTime }
+        });
+    }
+
+    void ChunkDependencyGraph::MarkGeneratedLocked(Node& node, const std::shared_ptr<Chunk>& chunk,
+                                                   std::vector<ChunkDecorationInput>& outDecorations) {
+        const ChunkCoord coord = chunk->GetCoord();
+
+        node.Generated = chunk;
+        --node.MissingTerrain;
+        TryDecorateLocked(coord, node, outDecorations);
+
+        for (const ChunkCoord offset : ChunkDecorationInput::c_NeighborOffsets) {
+            const ChunkCoord neighborCoord{ coord.X + offset.X, coord.Z + offset.Z };
+
+            if (Node* neighbor = FindLocked(neighborCoord)) {
+                --neighbor->MissingTerrain;
+                TryDecorateLocked(neighborCoord, *neighbor, outDecorations);
+            }
+        }
+    }
+
+    void ChunkDependencyGraph::MarkDecoratedLocked(const ChunkCoord coord, Node& node, std::vector<ReadyMesh>& outReady) {
+        node.Decorated = true;
+        --node.MissingInputs;
+        TryScheduleLocked(coord, node, outReady);
+
+        for (const ChunkCoord offset : c_NeighborOffsets) {
+            const ChunkCoord neighborCoord{ coord.X + offset.X, coord.Z + offset.Z };
+
+            if (Node* neighbor = FindLocked(neighborCoord)) {
+                --neighbor->MissingInputs;
+                TryScheduleLocked(neighborCoord, *neighbor, outReady);
+            }
+        }
+    }
+
+    ChunkDependencyGraph::Node* ChunkDependencyGraph::FindLocked(const ChunkCoord coord) noexcept {
+        auto it = m_Nodes.find(coord);
+        return it != m_Nodes.end() ? &it->second : nullptr;
+    }
+
+}
@@ -0,0 +1,115 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include "Chunk/ChunkCoord.h"
+#include "Chunk/ChunkNeighbor.h"
+
+#include <array>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+
+namespace Mct {
+
+    // Per chunk dependency counters for the generation -> decoration -> meshing stages.
+    //
+    // Decorating a chunk needs nine generated chunks: the chunk itself and the eight around it, whose
+    // trees may reach into it. A chunk mesh needs five decorated chunks: the chunk itself and its four
+    // horizontal neighbors. Every tracked chunk counts how many of either are still missing. The job
+    // finishing a stage decrements the counters of that chunk and its neighbors, and whichever reaches
+    // zero (a mesh only while wanted) is handed straight back to that worker to schedule, with no
+    // per-frame polling.
+    //
+    // All methods are thread safe.
+    //
+    class ChunkDependencyGraph {
+    public:
+        using Clock_T = std::chrono::steady_clock;
+
+        struct ReadyMesh {
+            ChunkMeshInput      Input;
+            Clock_T::time_point RequestTime;
+        };
+
+    public:
+        // Starts tracking newly requested chunks and updates which tracked chunks want a mesh, as told
+        // by wantsMesh(ChunkCoord) (called under the lock). Chunks which became ready are appended to outReady.
+        template<typename WantsMesh_T>
+        void UpdateRange(std::span<const ChunkCoord> newChunks, WantsMesh_T&& wantsMesh, std::vector<ReadyMesh>& outReady) {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+
+            TrackLocked(newChunks);
+
+            for (auto& [coord, node] : m_Nodes) {
+                node.WantsMesh = wantsMesh(coord);
+                TryScheduleLocked(coord, node, outReady);
+            }
+        }
+
+        // Starts tracking newly requested chunks without changing which chunks want a mesh.
+        void Track(std::span<const ChunkCoord> newChunks);
+
+        // Stops tracking the chunks, their neighbors become unready again. Generated chunks only the
+        // graph held (still waiting for their decoration) are moved to outDropped.
+        void Untrack(std::span<const ChunkCoord> chunks, std::vector<std::shared_ptr<Chunk>>& outDropped);
+
+        // Called by the terrain job, the graph keeps the chunk until its decoration finishes. Chunks no
+        // longer (or already) tracked are ignored. Chunks which can be decorated now are appended to
+        // outDecorations.
+        void OnTerrainGenerated(const std::shared_ptr<Chunk>& chunk, std::vector<ChunkDecorationInput>& outDecorations);
+
+        // Called by the decoration job, returns false when the chunk was untracked meanwhile. Chunks
+        // which became ready for meshing are appended to outReady.
+        [[nodiscard]] bool OnDecorated(const std::shared_ptr<Chunk>& chunk, std::vector<ReadyMesh>& outReady);
+
+        // Tracks a chunk which comes back already decorated (from the ChunkCache). meshed marks it as
+        // having its mesh already, so only neighbors it unblocks are appended to the outputs.
+        void Reinstate(const std::shared_ptr<Chunk>& chunk, bool meshed, std::vector<ChunkDecorationInput>& outDecorations,
+                       std::vector<ReadyMesh>& outReady);
+
+        // True when chunk is the generated chunk tracked for its coord. Results of a chunk which was
+        // unloaded and requested again while its job was in flight are stale and fail this check.
+        [[nodiscard]] bool IsCurrent(const std::shared_ptr<Chunk>& chunk);
+
+    private:
+        struct Node {
+            std::shared_ptr<Chunk> Generated;                   // Null until generated.
+            Clock_T::time_point    RequestTime;
+            uint8_t                MissingTerrain      = 9;     // Generated self + 8 neighbors.
+            uint8_t                MissingInputs       = 5;     // Decorated self + 4 neighbors.
+            bool                   DecorationScheduled = false;
+            bool                   Decorated           = false;
+            bool                   WantsMesh           = false;
+            bool                   MeshScheduled       = false;
+        };
+
+        static constexpr std::array<ChunkCoord, 4> c_NeighborOffsets{ {
+            { 0, -1 },  // North
+            { 0, +1 },  // South
+            { +1, 0 },  // East
+            { -1, 0 }   // West
+        } };
+
+    private:
+        void TrackLocked(std::span<const ChunkCoord> newChunks);
+        void TryDecorateLocked(ChunkCoord coord, Node& node, std::vector<ChunkDecorationInput>& outDecorations);
+        void TryScheduleLocked(ChunkCoord coord, Node& node, std::vector<ReadyMesh>& outReady);
+        void MarkGeneratedLocked(Node& node, const std::shared_ptr<Chunk>& chunk, std::vector<ChunkDecorationInput>& outDecorations);
+        void MarkDecoratedLocked(ChunkCoord coord, Node& node, std::vector<ReadyMesh>& outReady);
+
+        Node* FindLocked(ChunkCoord coord) noexcept;
+
+    private:
+        std::mutex                           m_Mutex;
+        std::unordered_map<ChunkCoord, Node> m_Nodes;
+    };
+
+}
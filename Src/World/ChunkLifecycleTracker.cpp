@@ -0,0 +1,139 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#include "ChunkLifecycleTracker.h"
+#include "Utils/Logger.h"
+#include "Utils/Profiler.h"
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+
+
+namespace Mct {
+
+    static constexpr const char* c_SpanNames[ChunkLifecycleTracker::c_SpanCount] = {
+        "Queued",               // Requested       -> GenerationStart
+        "Generation",           // GenerationStart -> GenerationEnd
+        "Decoration",           // GenerationEnd   -> Decorated
+        "Waiting neighbors",    // Decorated       -> MeshStart
+        "Meshing",              // MeshStart       -> MeshEnd
+        "Waiting upload",       // MeshEnd         -> Uploaded
+        "Waiting draw",         // Uploaded        -> FirstDrawn
+        "Total"                 // Requested       -> FirstDrawn
+    };
+
+    // Nearest rank percentile, values gets partially reordered.
+    static float Percentile(std::vector<float>& values, const float percentile) {
+        const size_t rank = static_cast<size_t>(percentile * static_cast<float>(values.size() - 1) + 0.5f);
+
+        std::nth_element(values.begin(), values.begin() + rank, values.end());
+        return values[rank];
+    }
+
+    const char* ChunkLifecycleTracker::GetSpanName(const size_t span) noexcept {
+        return span < c_SpanCount ? c_SpanNames[span] : "";
+    }
+
+    ChunkLifecycleTracker::ChunkLifecycleTracker() :
+            m_StartTime      ( Clock_T::now() ),
+            m_LastSampleTime ( m_StartTime    )
+    {
+        m_Samples.reserve(c_MaxSamples);
+        m_Scratch.reserve(c_MaxSamples);
+    }
+
+    void ChunkLifecycleTracker::Record(const ChunkCoord coord, const ChunkTimeline& timeline) {
+        using Millis_T  = std::chrono::duration<float, std::milli>;
+        using Seconds_T = std::chrono::duration<float>;
+
+        // Reinstated chunks have no generation stamps, their spans would start at the clock's epoch.
+        if (!timeline.HasThrough(ChunkLifecycleStage::FirstDrawn))
+            return;
+
+        Sample_T sample{
+            .Coord              { coord },
+            .RequestedAtSeconds { Seconds_T(timeline.Get(ChunkLifecycleStage::Requested) - m_StartTime).count() },
+            .SpanMs             {}
+        };
+
+        for (size_t span = 0; span < c_TotalSpan; ++span) {
+            const auto from = timeline.Get(static_cast<ChunkLifecycleStage>(span));
+            const auto to   = timeline.Get(static_cast<ChunkLifecycleStage>(span + 1));
+
+            sample.SpanMs[span] = Millis_T(to - from).count();
+        }
+
+        sample.SpanMs[c_TotalSpan] = Millis_T(timeline.Get(ChunkLifecycleStage::FirstDrawn) -
+                                              timeline.Get(ChunkLifecycleStage::Requested)).count();
+
+        if (m_Samples.size() < c_MaxSamples) {
+            m_Samples.push_back(sample);
+        }
+        else {
+            m_Samples[m_NextSample] = sample;
+            m_NextSample = (m_NextSample + 1) % c_MaxSamples;
+        }
+
+        ++m_RecordedCount;
+    }
+
+    bool ChunkLifecycleTracker::Sample() {
+        const Clock_T::time_point now = Clock_T::now();
+
+        if (now - m_LastSampleTime < c_SampleInterval || m_RecordedCount == m_LastSampledCount)
+            return false;
+
+        m_LastSampleTime   = now;
+        m_LastSampledCount = m_RecordedCount;
+
+        for (size_t span = 0; span < c_SpanCount; ++span) {
+            m_Scratch.clear();
+
+            for (const Sample_T& sample : m_Samples) {
+                m_Scratch.push_back(sample.SpanMs[span]);
+            }
+
+            m_Percentiles[span] = SpanPercentiles{
+                .P50Ms { Percentile(m_Scratch, 0.50f) },
+                .P95Ms { Percentile(m_Scratch, 0.95f) },
+                .P99Ms { Percentile(m_Scratch, 0.99f) }
+            };
+        }
+
+        MCT_PROFILE_VALUE("ChunkFirstDrawP95Ms", static_cast<double>(m_Percentiles[c_TotalSpan].P95Ms));
+        return true;
+    }
+
+    bool ChunkLifecycleTracker::ExportCsv(const std::filesystem::path& path) const {
+        std::ofstream file(path, std::ios::trunc);
+
+        if (!file.is_open()) {
+            MCT_ERROR("Failed to open {} for the chunk lifecycle export.", path.string());
+            return false;
+        }
+
+        file << "chunk_x,chunk_z,requested_s";
+        for (std::string name : c_SpanNames) {
+            std::ranges::replace(name, ' ', '_');
+            file << ',' << name << "_ms";
+        }
+        file << '\n';
+
+        // Oldest first, m_NextSample is the oldest entry once the ring wrapped.
+        for (size_t i = 0; i < m_Samples.size(); ++i) {
+            const Sample_T& sample = m_Samples[(m_NextSample + i) % m_Samples.size()];
+
+            file << sample.Coord.X << ',' << sample.Coord.Z << ',' << sample.RequestedAtSeconds;
+            for (const float spanMs : sample.SpanMs) {
+                file << ',' << spanMs;
+            }
+            file << '\n';
+        }
+
+        MCT_INFO("Exported {} chunk lifecycles to {}", m_Samples.size(), path.string());
+        return file.good();
+    }
+
+}
@@ -0,0 +1,83 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include "Chunk/ChunkCoord.h"
+#include "Chunk/ChunkTimeline.h"
+
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <vector>
+
+
+namespace Mct {
+
+    // Aggregates the timelines of chunks which reached FirstDrawn into per span latency percentiles.
+    //
+    // A span is the time between two consecutive lifecycle stages, plus Total (Requested to
+    // FirstDrawn). The most recent c_MaxSamples chunks are kept, both for the percentiles and for
+    // the CSV export. Main thread only.
+    //
+    class ChunkLifecycleTracker {
+    public:
+        static constexpr size_t c_SpanCount  = static_cast<size_t>(ChunkLifecycleStage::COUNT);  // COUNT - 1 spans + Total
+        static constexpr size_t c_TotalSpan  = c_SpanCount - 1;
+        static constexpr size_t c_MaxSamples = 4096;
+
+        // Percentiles are recomputed at most this often.
+        static constexpr auto c_SampleInterval = std::chrono::milliseconds(500);
+
+        struct SpanPercentiles {
+            float P50Ms = 0.0f;
+            float P95Ms = 0.0f;
+            float P99Ms = 0.0f;
+        };
+
+        [[nodiscard]] static const char* GetSpanName(size_t span) noexcept;
+
+    public:
+        ChunkLifecycleTracker();
+
+        // Records a chunk which just got stamped FirstDrawn. Chunks missing earlier stamps (reinstated
+        // from the ChunkCache) are skipped.
+        void Record(ChunkCoord coord, const ChunkTimeline& timeline);
+
+        // Recomputes the percentiles when c_SampleInterval elapsed, returns true when it did.
+        bool Sample();
+
+        // One row per retained chunk, span durations in milliseconds.
+        bool ExportCsv(const std::filesystem::path& path) const;
+
+        [[nodiscard]] const std::array<SpanPercentiles, c_SpanCount>& GetPercentiles() const noexcept { return m_Percentiles; }
+
+        [[nodiscard]] size_t   GetSampleCount()   const noexcept { return m_Samples.size(); }
+        [[nodiscard]] uint64_t GetRecordedCount() const noexcept { return m_RecordedCount; }
+
+    private:
+        using Clock_T = ChunkTimeline::Clock_T;
+
+        struct Sample_T {
+            ChunkCoord                        Coord;
+            float                             RequestedAtSeconds;  // Since the tracker was created.
+            std::array<float, c_SpanCount>    SpanMs;
+        };
+
+    private:
+        Clock_T::time_point m_StartTime;
+        Clock_T::time_point m_LastSampleTime;
+        uint64_t            m_RecordedCount    = 0;
+        uint64_t            m_LastSampledCount = 0;
+
+        // Ring buffer, m_NextSample is the oldest entry once it is full.
+        std::vector<Sample_T> m_Samples;
+        size_t                m_NextSample = 0;
+
+        std::array<SpanPercentiles, c_SpanCount> m_Percentiles{};
+        std::vector<float>                       m_Scratch;
+    };
+
+}
@@ -6,31 +6,84 @@
 
 #include "ChunkManager.h"
 #include "TerrainGeneration/TerrainGenerator.h"
+#include "TerrainGeneration/ChunkDecorator.h"
+#include "Utils/Coroutine.h"
 #include "Utils/Profiler.h"
 
+#include <algorithm>
+
 
 namespace Mct {
 
-    ChunkManager::ChunkManager(TerrainGenerator generator) :
-            m_TerrainGenerator     ( std::move(generator)      ),
-            m_PrevPlayerPos        ( ChunkCoord::MakeInvalid() ),
-			m_TerrainGeneratorPool ( 6, TerrainGenFunctor(m_TerrainGenerator, &m_TerrainGeneratorResults) ),
-			m_ChunkMeshGenPool     ( 6, ChunkMeshGenFunctor(&m_ChunkMeshGenResults)              )
+    ChunkManager::ChunkManager(TerrainGenerator generator, JobSystem& jobSystem) :
+            m_TerrainGenerator ( std::move(generator)      ),
+            m_PrevPlayerPos    ( ChunkCoord::MakeInvalid() ),
+            m_JobSystem        ( jobSystem                 ),
+            m_Reclaimer        ( jobSystem                 ),
+            m_ChunkCache       ( m_Reclaimer               )
 	{}
 
-    void ChunkManager::Update(glm::vec3 playerPos) {
+    ChunkManager::~ChunkManager() {
+        // Coroutines still waiting can't be resumed anymore, their frames are freed instead.
+        for (auto& [coord, waiters] : m_ChunkWaiters) {
+            for (ChunkWaiter& waiter : waiters) {
+                waiter.Handle.destroy();
+            }
+        }
+
+        for (ChunkWaiter& waiter : m_ReadyWaiters) {
+            waiter.Handle.destroy();
+        }
+
+        for (ChunkWaiter& waiter : m_RequestInbox) {
+            waiter.Handle.destroy();
+        }
+
+        for (std::coroutine_handle<> handle : m_MainThreadWork.Resumes) {
+            handle.destroy();
+        }
+    }
+
+    void ChunkManager::Update(glm::vec3 playerPos, glm::vec3 playerVelocity) {
         MCT_PROFILE_FUNCTION();
 
         ProcessPendingResults();
+        AcceptRequests();
 
         const ChunkCoord playerChunkPos = ChunkCoord::FromWorldXZ(playerPos.x, playerPos.z);
 
-        if (m_PrevPlayerPos.IsValid() || m_PrevPlayerPos != playerChunkPos) {
+        // Generation capacity of the whole pool, from the measured time to generate one chunk.
+        const float chunksPerSecond = static_cast<float>(m_JobSystem.GetWorkerCount()) / m_GenerationSecondsEma;
+
+        const bool lookAheadChanged = m_LookAhead.Update(playerChunkPos, playerVelocity, m_PipelineLatencyEma,
+                                                         chunksPerSecond, WorldConst::LoadDistance);
+
+        // The range only changes when the player crosses a chunk boundary or the look-ahead cone
+        // changes, meshing is driven by the dependency graph and needs no per frame scan.
+        if (!m_PrevPlayerPos.IsValid() || m_PrevPlayerPos != playerChunkPos || lookAheadChanged) {
             m_PrevPlayerPos = playerChunkPos;
 
+            UnloadOutOfRangeChunks();
             LoadChunksInRange(playerChunkPos);
-            UnloadOutOfRangeChunks(playerChunkPos);
         }
+
+        // Parked meshes first, terrain only gets slots while meshing keeps up.
+        PumpParkedMeshes();
+        PumpTerrainQueue();
+
+        ResumeReadyWaiters();
+        m_Reclaimer.Flush();
+
+        m_PipelineStats.TerrainQueued   = m_QueuedTerrain.size();
+        m_PipelineStats.TerrainInFlight = m_TerrainChunksInFlight.load(std::memory_order_relaxed);
+        m_PipelineStats.ParkedMeshes    = m_ParkedMeshCount.load(std::memory_order_relaxed);
+        m_PipelineStats.MeshesInFlight  = m_MeshJobsInFlight.load(std::memory_order_relaxed);
+        m_PipelineStats.PendingUploads  = m_PendingUploadCount.load(std::memory_order_relaxed);
+        m_PipelineStats.MeshStalls      = m_MeshStalls.load(std::memory_order_relaxed);
+
+        MCT_PROFILE_VALUE("TerrainQueued",  static_cast<int64_t>(m_PipelineStats.TerrainQueued));
+        MCT_PROFILE_VALUE("ParkedMeshes",   static_cast<int64_t>(m_PipelineStats.ParkedMeshes));
+        MCT_PROFILE_VALUE("PendingUploads", static_cast<int64_t>(m_PipelineStats.PendingUploads));
 	}
 
     std::shared_ptr<Chunk> ChunkManager::GetChunk(ChunkCoord pos) {
@@ -41,109 +94,633 @@ namespace Mct {
     }
 
     void ChunkManager::ProcessPendingResults() {
-        // Stores chunks returned by the terrain generator.
+        // Mesh results are drained first, DecorateJob pushes a chunk before its mesh can be scheduled.
+        // The decorated drain below still stops at a slot another job claimed but hasn't published
+        // yet, the chunks behind it come next frame. Their meshes are kept until then, see below.
+        m_ChunkMeshGenResults.DrainInto(m_DrainedMeshResults);
+
+        // Stores chunks which finished their decoration.
         {
-            std::vector<std::shared_ptr<Chunk>> results = m_TerrainGeneratorResults.Drain();
+            m_DecoratedChunks.DrainInto(m_DrainedDecoratedChunks);
+
+            for (auto& result : m_DrainedDecoratedChunks) {
+                // Dropped when unloaded (and maybe requested again) while in the channel.
+                if (!m_DependencyGraph.IsCurrent(result)) {
+                    m_Reclaimer.Retire(std::move(result));
+                    continue;
+                }
 
-            for (auto& result : results) {
                 ChunkCoord currChunkCoord = result->GetCoord();
+                ResolveWaiters(currChunkCoord, result, ChunkStage::Generated);
+
                 m_LoadedChunks[currChunkCoord] = std::move(result);
                 m_ChunksInTerrainGeneration.erase(currChunkCoord);
+                ++m_LoadedSetVersion;
             }
+
+            m_DrainedDecoratedChunks.clear();
         }
 
         // Stores mesh returned by the mesh generator.
         {
-            std::vector<ChunkMeshGenResult> results = m_ChunkMeshGenResults.Drain();
+            // Meshes of chunks still on their way through m_DecoratedChunks, moved to the front.
+            size_t keptCount = 0;
+
+            for (auto& result : m_DrainedMeshResults) {
+                auto it = m_LoadedChunks.find(result.SourceChunk->GetCoord());
+
+                // Never meshed again by the graph, dropping it would leave a hole for good.
+                if (it == m_LoadedChunks.end() && m_DependencyGraph.IsCurrent(result.SourceChunk)) {
+                    if (&m_DrainedMeshResults[keptCount] != &result) {
+                        m_DrainedMeshResults[keptCount] = std::move(result);
+                    }
+
+                    ++keptCount;
+                    continue;
+                }
 
-            for (auto& result : results) {
-                auto it = m_LoadedChunks.find(result.ChunkCoord);
+                ReleaseMeshSlot();
 
-                if (it != m_LoadedChunks.end()) {
-                    it->second->SetMesh(std::move(result.ChunkMesh));
+                if (it != m_LoadedChunks.end() && it->second == result.SourceChunk) {
+                    m_MainThreadWork.Uploads.push_back({ it->second, std::move(result.ChunkMesh) });
+                    m_MeshedChunks.insert(it->first);
+                    RecordMeshLatency(result.RequestTime);
+                    RecordPipelineTimes(it->second->GetTimeline());
+                    ResolveWaiters(it->first, it->second, ChunkStage::Meshed);
+                    continue;
                 }
 
-                m_ChunksInMeshGeneration.erase(result.ChunkCoord);
+                // Stale, the source chunk may hold the last reference to an unloaded chunk.
+                m_Reclaimer.Retire(std::move(result.SourceChunk));
+                m_Reclaimer.Retire(std::move(result.ChunkMesh));
             }
+
+            m_DrainedMeshResults.erase(m_DrainedMeshResults.begin() + static_cast<std::ptrdiff_t>(keptCount), m_DrainedMeshResults.end());
+        }
+
+        // Evicted chunks coming back from the main thread, their GPU mesh joins the cache entry.
+        {
+            m_EvictedMeshes.DrainInto(m_DrainedEvictedMeshes);
+
+            for (EvictedMesh& evicted : m_DrainedEvictedMeshes) {
+                if (evicted.GpuMesh) {
+                    m_ChunkCache.AttachGpuMesh(*evicted.SourceChunk, std::move(evicted.GpuMesh));
+                }
+
+                m_Reclaimer.Retire(std::move(evicted.SourceChunk));
+            }
+
+            m_DrainedEvictedMeshes.clear();
         }
     }
 
-    void ChunkManager::LoadChunksInRange(ChunkCoord playerChunkPos) {
-        const int loadDist   = WorldConst::LoadDistance;
+    void ChunkManager::AcceptRequests() {
+        std::vector<ChunkWaiter> requests;
+        {
+            std::lock_guard<std::mutex> lock(m_RequestInboxMutex);
+            requests.swap(m_RequestInbox);
+        }
+
+        for (const ChunkWaiter& waiter : requests) {
+            if (std::shared_ptr<Chunk> chunk = FindChunkAtStage(waiter.Request->m_Coord, waiter.Request->m_Stage)) {
+                waiter.Request->m_Result = std::move(chunk);
+                m_ReadyWaiters.push_back(waiter);
+                continue;
+            }
+
+            AddWaiter(waiter);
+        }
+    }
+
+    bool ChunkManager::IsInLoadRange(ChunkCoord coord) const noexcept {
+        const int loadDist = WorldConst::LoadDistance;
+
+        const int distX = std::abs(coord.X - m_PrevPlayerPos.X);
+        const int distZ = std::abs(coord.Z - m_PrevPlayerPos.Z);
+
+        return (distX <= loadDist && distZ <= loadDist) || m_LookAhead.IsInCone(coord, loadDist);
+    }
+
+    bool ChunkManager::IsInRenderRange(ChunkCoord coord) const noexcept {
         const int renderDist = WorldConst::RenderDistance;
 
-        std::vector<ChunkCoord> chunksForTerrainGen;
+        const int distX = std::abs(coord.X - m_PrevPlayerPos.X);
+        const int distZ = std::abs(coord.Z - m_PrevPlayerPos.Z);
+
+        return (distX <= renderDist && distZ <= renderDist) || m_LookAhead.IsInCone(coord, renderDist);
+    }
+
+    bool ChunkManager::IsNeededForDecoration(const ChunkCoord coord) const noexcept {
+        for (const ChunkCoord offset : ChunkDecorationInput::c_NeighborOffsets) {
+            const ChunkCoord neighbor{ coord.X + offset.X, coord.Z + offset.Z };
 
-        std::vector<ChunkCoord> chunksForMeshGen;
-        std::vector<ChunkMeshInput> chunksMeshGenInputs;
+            if (m_ChunkWaiters.contains(neighbor) && m_ChunksInTerrainGeneration.contains(neighbor))
+                return true;
+        }
+
+        return false;
+    }
+
+    void ChunkManager::LoadChunksInRange(ChunkCoord playerChunkPos) {
+        // Big enough for the load square and the cone, whichever way it points.
+        const int scanDist = WorldConst::LoadDistance + m_LookAhead.GetLookAheadChunks();
+
+        std::vector<ChunkCoord> urgentChunks;
+        std::vector<ChunkCoord> backgroundChunks;
+
+        std::vector<ChunkDecorationInput>            readyDecorations;
+        std::vector<ChunkDependencyGraph::ReadyMesh> readyMeshes;
 
-        for (int x = playerChunkPos.X - loadDist; x <= playerChunkPos.X + loadDist; ++x) {
-            for (int z = playerChunkPos.Z - loadDist; z <= playerChunkPos.Z + loadDist; ++z) {
+        for (int x = playerChunkPos.X - scanDist; x <= playerChunkPos.X + scanDist; ++x) {
+            for (int z = playerChunkPos.Z - scanDist; z <= playerChunkPos.Z + scanDist; ++z) {
                 ChunkCoord pos = { x, z };
 
-                if (m_LoadedChunks.contains(pos)) {
-                    const int distFromPlayerX = std::abs(x - playerChunkPos.X);
-                    const int distFromPlayerZ = std::abs(z - playerChunkPos.Z);
+                if (m_LoadedChunks.contains(pos) || m_ChunksInTerrainGeneration.contains(pos) || !IsInLoadRange(pos))
+                    continue;
 
-                    // Queue for Remesh only when in the render distance.
-                    if (distFromPlayerX <= renderDist && distFromPlayerZ <= renderDist) {
-                        if (!m_ChunksInMeshGeneration.contains(pos) && m_LoadedChunks[pos]->NeedRemesh()) {
-                            std::optional<ChunkMeshInput> meshInput = GetChunkMeshInputData(pos);
+                if (TryReinstate(pos, readyDecorations, readyMeshes))
+                    continue;
 
-                            if (meshInput) {
-                                chunksMeshGenInputs.emplace_back(std::move(*meshInput));
-                                chunksForMeshGen.emplace_back(pos.X, pos.Z);
-                            }
-                        }
-                    }
+                // The outer ring away from the direction of travel only has to be ready eventually.
+                if (IsInRenderRange(pos) || m_LookAhead.IsInCone(pos, WorldConst::LoadDistance)) {
+                    urgentChunks.push_back(pos);
                 }
-                else if (!m_ChunksInTerrainGeneration.contains(pos)) {   // If the chunk doesn't exist, add it.
-                    chunksForTerrainGen.emplace_back(pos.X, pos.Z);
+                else {
+                    backgroundChunks.push_back(pos);
                 }
             }
         }
 
-        m_ChunksInTerrainGeneration.insert(chunksForTerrainGen.begin(), chunksForTerrainGen.end());
-        m_TerrainGeneratorPool.SubmitBatch(chunksForTerrainGen);
+        std::vector<ChunkCoord> newChunks;
+        newChunks.reserve(urgentChunks.size() + backgroundChunks.size());
+        newChunks.insert(newChunks.end(), urgentChunks.begin(), urgentChunks.end());
+        newChunks.insert(newChunks.end(), backgroundChunks.begin(), backgroundChunks.end());
+
+        // Must track the new chunks before their jobs can finish. Chunks already generated which
+        // just entered the render range (or the cone) come back ready right away.
+        m_DependencyGraph.UpdateRange(newChunks, [this](ChunkCoord coord) { return IsInRenderRange(coord); }, readyMeshes);
 
-        m_ChunksInMeshGeneration.insert(chunksForMeshGen.begin(), chunksForMeshGen.end());
-        m_ChunkMeshGenPool.SubmitBatch(std::move(chunksMeshGenInputs));
+        SubmitTerrainJobs(urgentChunks,     JobPriority::Normal);
+        SubmitTerrainJobs(backgroundChunks, JobPriority::Low);
+        SubmitDecorationJobs(readyDecorations);
+        SubmitMeshJobs(readyMeshes);
     }
 
-    void ChunkManager::UnloadOutOfRangeChunks(ChunkCoord playerChunkPos) {
-        const int loadDist   = WorldConst::LoadDistance;
-        const int renderDist = WorldConst::RenderDistance;
+    void ChunkManager::UnloadOutOfRangeChunks() {
+        std::vector<ChunkCoord> untracked;
 
         // Unload Pass
         for (auto it = m_LoadedChunks.begin(); it != m_LoadedChunks.end(); ) {
-            ChunkCoord chunkPos = it->first;
+            if (!IsInLoadRange(it->first) && !IsNeededForDecoration(it->first)) {
+                ResolveWaiters(it->first, nullptr, ChunkStage::Generated);
+                untracked.push_back(it->first);
+                m_MeshedChunks.erase(it->first);
+                m_ChunkCache.Insert(*it->second);
+
+                // The main thread takes its GPU mesh and returns it, see ProcessPendingResults.
+                m_MainThreadWork.Evictions.push_back(std::move(it->second));
+                it = m_LoadedChunks.erase(it);
+                ++m_LoadedSetVersion;
+                continue;
+            }
 
-            int distX = std::abs(chunkPos.X - playerChunkPos.X);
-            int distZ = std::abs(chunkPos.Z - playerChunkPos.Z);
+            ++it;
+        }
 
-            if (distX > loadDist || distZ > loadDist) {
-                it = m_LoadedChunks.erase(it);
+        // Chunks still generating are forgotten as well, the graph drops their results. Unless someone
+        // awaits them (or a neighbor they are decorated with), those are kept until decorated and
+        // unloaded afterwards.
+        for (auto it = m_ChunksInTerrainGeneration.begin(); it != m_ChunksInTerrainGeneration.end(); ) {
+            if (!IsInLoadRange(*it) && !m_ChunkWaiters.contains(*it) && !IsNeededForDecoration(*it)) {
+                untracked.push_back(*it);
+                m_QueuedTerrain.erase(*it);
+                it = m_ChunksInTerrainGeneration.erase(it);
                 continue;
             }
 
             ++it;
         }
+
+        std::vector<std::shared_ptr<Chunk>> dropped;
+        m_DependencyGraph.Untrack(untracked, dropped);
+
+        for (std::shared_ptr<Chunk>& chunk : dropped) {
+            m_Reclaimer.Retire(std::move(chunk));
+        }
+
+        // Forget queue entries of requests dropped above, so a long stall doesn't accumulate them.
+        auto isDropped = [this](const QueuedTerrain& queued) { return !m_QueuedTerrain.contains(queued.Coord); };
+        std::erase_if(m_UrgentTerrainQueue,     isDropped);
+        std::erase_if(m_BackgroundTerrainQueue, isDropped);
+    }
+
+    void ChunkManager::SubmitTerrainJobs(std::span<const ChunkCoord> coords, JobPriority priority) {
+        if (coords.empty())
+            return;
+
+        m_ChunksInTerrainGeneration.insert(coords.begin(), coords.end());
+
+        // Time spent in the queue counts as queued in the chunk's lifecycle.
+        const ChunkTimeline::Clock_T::time_point requestTime = ChunkTimeline::Clock_T::now();
+
+        std::deque<QueuedTerrain>& queue = priority == JobPriority::Low ? m_BackgroundTerrainQueue : m_UrgentTerrainQueue;
+
+        for (const ChunkCoord pos : coords) {
+            m_QueuedTerrain.emplace(pos, requestTime);
+            queue.push_back(QueuedTerrain{ pos, requestTime });
+        }
+    }
+
+    void ChunkManager::PumpTerrainQueue() {
+        // Generating more while meshing is behind would only pile up chunks waiting for a mesh.
+        const bool meshingBehind = m_ParkedMeshCount.load(std::memory_order_relaxed) >= m_PipelineLimits.ParkedMeshes;
+
+        size_t inFlight = m_TerrainChunksInFlight.load(std::memory_order_relaxed);
+
+        std::vector<JobSystem::JobDesc> jobs;
+
+        // The chunks of the region tile still queued go along in the same job, whatever their
+        // queue, they share the tile's 2D noise and blending.
+        auto takeRegion = [this](const ChunkCoord coord) {
+            std::vector<QueuedTerrain> region;
+            const ChunkCoord           origin = TerrainGenerator::GetRegionOrigin(coord);
+
+            for (int x = 0; x < TerrainGenerator::c_RegionSize; ++x) {
+                for (int z = 0; z < TerrainGenerator::c_RegionSize; ++z) {
+                    const auto it = m_QueuedTerrain.find(ChunkCoord{ .X = origin.X + x, .Z = origin.Z + z });
+                    if (it == m_QueuedTerrain.end())
+                        continue;
+
+                    region.push_back(QueuedTerrain{ it->first, it->second });
+                    m_QueuedTerrain.erase(it);
+                }
+            }
+
+            return region;
+        };
+
+        auto takeFrom = [&](std::deque<QueuedTerrain>& queue, const JobPriority priority) {
+            while (!queue.empty() && !meshingBehind && inFlight < m_PipelineLimits.TerrainChunks) {
+                const QueuedTerrain queued = queue.front();
+                queue.pop_front();
+
+                // Unloaded while queued, or already submitted.
+                if (!m_QueuedTerrain.contains(queued.Coord))
+                    continue;
+
+                std::vector<QueuedTerrain> region = takeRegion(queued.Coord);
+                inFlight += region.size();
+
+                jobs.push_back({
+                    .Kind     { JobKind::Terrain },
+                    .Priority { priority         },
+                    .Job      { [this, region = std::move(region)] {
+                        GenerateTerrainJob(region);
+                        m_TerrainChunksInFlight.fetch_sub(region.size(), std::memory_order_relaxed);
+                    } }
+                });
+            }
+        };
+
+        const size_t inFlightBefore = inFlight;
+
+        takeFrom(m_UrgentTerrainQueue,     JobPriority::Normal);
+        takeFrom(m_BackgroundTerrainQueue, JobPriority::Low);
+
+        if (!m_QueuedTerrain.empty()) {
+            ++m_PipelineStats.TerrainStalls;
+        }
+
+        if (jobs.empty())
+            return;
+
+        m_TerrainChunksInFlight.fetch_add(inFlight - inFlightBefore, std::memory_order_relaxed);
+        m_JobSystem.SubmitBatch(std::move(jobs));
+    }
+
+    void ChunkManager::PumpParkedMeshes() {
+        m_ParkedMeshChannel.DrainInto(m_ParkedMeshes);
+
+        if (m_ParkedMeshes.empty())
+            return;
+
+        const size_t parkedCount = m_ParkedMeshes.size();
+
+        // Unloaded while parked.
+        std::erase_if(m_ParkedMeshes, [this](ChunkDependencyGraph::ReadyMesh& readyMesh) {
+            if (m_DependencyGraph.IsCurrent(readyMesh.Input.GetMainChunk()))
+                return false;
+
+            m_Reclaimer.Retire(std::move(readyMesh.Input.GetMainChunk()));
+            return true;
+        });
+
+        // Nearest first, they are the ones about to be drawn.
+        auto distanceToPlayer = [this](ChunkDependencyGraph::ReadyMesh& readyMesh) {
+            const ChunkCoord coord = readyMesh.Input.GetMainChunk()->GetCoord();
+            return std::max(std::abs(coord.X - m_PrevPlayerPos.X), std::abs(coord.Z - m_PrevPlayerPos.Z));
+        };
+
+        std::sort(m_ParkedMeshes.begin(), m_ParkedMeshes.end(),
+            [&](ChunkDependencyGraph::ReadyMesh& a, ChunkDependencyGraph::ReadyMesh& b) {
+                return distanceToPlayer(a) < distanceToPlayer(b);
+            });
+
+        size_t submitCount = 0;
+        while (submitCount < m_ParkedMeshes.size() && TryReserveMeshSlot()) {
+            ++submitCount;
+        }
+
+        std::vector<JobSystem::JobDesc> jobs;
+        jobs.reserve(submitCount);
+
+        for (size_t i = 0; i < submitCount; ++i) {
+            jobs.push_back(MakeMeshJob(std::move(m_ParkedMeshes[i])));
+        }
+
+        m_ParkedMeshes.erase(m_ParkedMeshes.begin(), m_ParkedMeshes.begin() + static_cast<std::ptrdiff_t>(submitCount));
+        m_ParkedMeshCount.fetch_sub(parkedCount - m_ParkedMeshes.size(), std::memory_order_relaxed);
+
+        if (!jobs.empty()) {
+            m_JobSystem.SubmitBatch(std::move(jobs));
+        }
+    }
+
+    bool ChunkManager::TryReinstate(const ChunkCoord coord, std::vector<ChunkDecorationInput>& outDecorations,
+                                    std::vector<ChunkDependencyGraph::ReadyMesh>& outReady) {
+        std::shared_ptr<Chunk> chunk = m_ChunkCache.TryTake(coord);
+        if (!chunk)
+            return false;
+
+        const bool meshed = !chunk->NeedRemesh();
+
+        // Neighbors waiting on this chunk are unblocked exactly like by its terrain and decoration jobs.
+        m_DependencyGraph.Reinstate(chunk, meshed, outDecorations, outReady);
+        ResolveWaiters(coord, chunk, meshed ? ChunkStage::Meshed : ChunkStage::Generated);
+
+        if (meshed) {
+            m_MeshedChunks.insert(coord);
+        }
+
+        m_LoadedChunks.emplace(coord, std::move(chunk));
+        ++m_LoadedSetVersion;
+        return true;
+    }
+
+    void ChunkManager::RecordMeshLatency(const ChunkDependencyGraph::Clock_T::time_point requestTime) {
+        using Millis_T = std::chrono::duration<float, std::milli>;
+
+        const float latencyMs = Millis_T(ChunkDependencyGraph::Clock_T::now() - requestTime).count();
+
+        ++m_MeshLatency.MeshedChunks;
+        m_MeshLatency.LastMs     = latencyMs;
+        m_MeshLatency.MaxMs      = std::max(m_MeshLatency.MaxMs, latencyMs);
+        m_MeshLatency.AverageMs += (latencyMs - m_MeshLatency.AverageMs) / static_cast<float>(m_MeshLatency.MeshedChunks);
+
+        MCT_PROFILE_VALUE("TimeToFirstMeshMs", static_cast<double>(latencyMs));
+    }
+
+    void ChunkManager::RecordPipelineTimes(const ChunkTimeline& timeline) {
+        using Seconds_T = std::chrono::duration<float>;
+
+        // A reinstated chunk being remeshed was never generated here, its missing stamps would read
+        // as the clock's epoch and swamp both averages.
+        if (!timeline.HasThrough(ChunkLifecycleStage::MeshEnd))
+            return;
+
+        // Exponential moving averages, recent chunks matter more than the ones of the first load.
+        constexpr float Alpha = 0.1f;
+
+        // The share of this chunk in its terrain job.
+        const float generationSeconds = Seconds_T(timeline.Get(ChunkLifecycleStage::GenerationEnd) -
+                                                  timeline.Get(ChunkLifecycleStage::GenerationStart)).count() /
+                                        static_cast<float>(timeline.GenerationBatch);
+
+        const float pipelineSeconds   = Seconds_T(timeline.Get(ChunkLifecycleStage::MeshEnd) -
+                                                  timeline.Get(ChunkLifecycleStage::GenerationStart)).count();
+
+        m_GenerationSecondsEma += (std::max(generationSeconds, 1e-4f) - m_GenerationSecondsEma) * Alpha;
+        m_PipelineLatencyEma   += (pipelineSeconds - m_PipelineLatencyEma) * Alpha;
+    }
+
+    void ChunkManager::GenerateTerrainJob(const std::span<const QueuedTerrain> queued) {
+        std::vector<std::shared_ptr<Chunk>> newChunks;
+        std::vector<Chunk*>                 region;
+
+        newChunks.reserve(queued.size());
+        region.reserve(queued.size());
+
+        for (const QueuedTerrain& entry : queued) {
+            auto newChunk = std::make_shared<Chunk>(entry.Coord);
+
+            ChunkTimeline& timeline = newChunk->GetTimeline();
+            timeline.Stamp(ChunkLifecycleStage::Requested, entry.RequestTime);
+            timeline.Stamp(ChunkLifecycleStage::GenerationStart);
+            timeline.GenerationBatch = static_cast<uint32_t>(queued.size());
+
+            region.push_back(newChunk.get());
+            newChunks.push_back(std::move(newChunk));
+        }
+
+        m_TerrainGenerator.GenerateRegion(region);
+
+        const ChunkTimeline::Clock_T::time_point generationEnd = ChunkTimeline::Clock_T::now();
+
+        // Decorations unblocked by these chunks are scheduled right here, onto this worker's own queue.
+        // The graph holds the chunks until their decoration, stale ones are dropped with newChunks.
+        std::vector<ChunkDecorationInput> readyDecorations;
+
+        for (const std::shared_ptr<Chunk>& newChunk : newChunks) {
+            newChunk->GetTimeline().Stamp(ChunkLifecycleStage::GenerationEnd, generationEnd);
+            m_DependencyGraph.OnTerrainGenerated(newChunk, readyDecorations);
+        }
+
+        SubmitDecorationJobs(readyDecorations);
+    }
+
+    void ChunkManager::DecorateJob(ChunkDecorationInput& input) {
+        ChunkDecorator::Decorate(input);
+        input.Main->GetTimeline().Stamp(ChunkLifecycleStage::Decorated);
+
+        // Pushed before the graph marks it decorated, from then on another worker's decoration can
+        // schedule its mesh, and a mesh result arriving before its chunk would be dropped as stale
+        // with MeshScheduled left set. Stale chunks are filtered out by ProcessPendingResults.
+        m_DecoratedChunks.Push(std::shared_ptr<Chunk>(input.Main));
+
+        std::vector<ChunkDependencyGraph::ReadyMesh> readyMeshes;
+        (void)m_DependencyGraph.OnDecorated(input.Main, readyMeshes);
+
+        SubmitMeshJobs(readyMeshes);
+    }
+
+    void ChunkManager::SubmitDecorationJobs(std::span<ChunkDecorationInput> inputs) {
+        if (inputs.empty())
+            return;
+
+        std::vector<JobSystem::JobDesc> jobs;
+        jobs.reserve(inputs.size());
+
+        // High like the meshes, a decoration is all that stands between generated terrain and its mesh.
+        for (ChunkDecorationInput& input : inputs) {
+            jobs.push_back({
+                .Kind     { JobKind::Decoration },
+                .Priority { JobPriority::High   },
+                .Job      { [this, input = std::move(input)]() mutable { DecorateJob(input); } }
+            });
+        }
+
+        m_JobSystem.SubmitBatch(std::move(jobs));
+    }
+
+    void ChunkManager::GenerateMeshJob(ChunkDependencyGraph::ReadyMesh& readyMesh) {
+        std::shared_ptr<Chunk>&    chunk     = readyMesh.Input.GetMainChunk();
+        std::unique_ptr<ChunkMesh> chunkMesh = std::make_unique<ChunkMesh>();
+
+        // Only the mesh job of a chunk stamps these, the main thread reads them after the result.
+        chunk->GetTimeline().Stamp(ChunkLifecycleStage::MeshStart);
+        ChunkMeshGenerator::GenerateChunkMeshes(*chunkMesh, readyMesh.Input);
+        chunk->GetTimeline().Stamp(ChunkLifecycleStage::MeshEnd);
+        m_ChunkMeshGenResults.Push(ChunkMeshGenResult{ chunk, std::move(chunkMesh), readyMesh.RequestTime });
+    }
+
+    void ChunkManager::SubmitMeshJobs(std::span<ChunkDependencyGraph::ReadyMesh> readyMeshes) {
+        if (readyMeshes.empty())
+            return;
+
+        std::vector<JobSystem::JobDesc> jobs;
+        jobs.reserve(readyMeshes.size());
+
+        for (ChunkDependencyGraph::ReadyMesh& readyMesh : readyMeshes) {
+            if (!TryReserveMeshSlot()) {
+                m_ParkedMeshCount.fetch_add(1, std::memory_order_relaxed);
+                m_MeshStalls.fetch_add(1, std::memory_order_relaxed);
+                m_ParkedMeshChannel.Push(std::move(readyMesh));
+                continue;
+            }
+
+            jobs.push_back(MakeMeshJob(std::move(readyMesh)));
+        }
+
+        if (!jobs.empty()) {
+            m_JobSystem.SubmitBatch(std::move(jobs));
+        }
     }
 
-    std::optional<ChunkMeshInput> ChunkManager::GetChunkMeshInputData(ChunkCoord pos) {
-        ChunkMeshInput chunks{
-            GetChunk(pos),
-            GetChunk({ pos.X, pos.Z - 1 }),
-            GetChunk({ pos.X, pos.Z + 1 }),
-            GetChunk({ pos.X + 1, pos.Z }),
-            GetChunk({ pos.X - 1, pos.Z })
+    JobSystem::JobDesc ChunkManager::MakeMeshJob(ChunkDependencyGraph::ReadyMesh&& readyMesh) {
+        // Meshes are queued as High, they turn already generated terrain into visible chunks.
+        return {
+            .Kind     { JobKind::Mesh     },
+            .Priority { JobPriority::High },
+            .Job      { [this, mesh = std::move(readyMesh)]() mutable { GenerateMeshJob(mesh); } }
         };
+    }
+
+    bool ChunkManager::TryReserveMeshSlot() noexcept {
+        size_t inFlight = m_MeshJobsInFlight.load(std::memory_order_relaxed);
 
-        if (!chunks.IsValid()) {
-            return std::nullopt;
+        // Meshes in flight end up waiting for upload, both count against the upload stage.
+        do {
+            const size_t pendingUploads = m_PendingUploadCount.load(std::memory_order_relaxed);
+
+            if (inFlight >= m_PipelineLimits.MeshJobs || inFlight + pendingUploads >= m_PipelineLimits.PendingUploads)
+                return false;
         }
+        while (!m_MeshJobsInFlight.compare_exchange_weak(inFlight, inFlight + 1, std::memory_order_relaxed));
+
+        return true;
+    }
+
+    std::shared_ptr<Chunk> ChunkManager::FindChunkAtStage(ChunkCoord coord, ChunkStage stage) {
+        if (stage == ChunkStage::Meshed && !m_MeshedChunks.contains(coord))
+            return nullptr;
+
+        return GetChunk(coord);
+    }
+
+    void ChunkManager::PostRequest(ChunkRequest& request, std::coroutine_handle<> handle) {
+        std::lock_guard<std::mutex> lock(m_RequestInboxMutex);
+        m_RequestInbox.push_back(ChunkWaiter{ &request, handle });
+    }
+
+    void ChunkManager::AddWaiter(const ChunkWaiter& waiter) {
+        const ChunkCoord coord = waiter.Request->m_Coord;
+
+        m_ChunkWaiters[coord].push_back(waiter);
+
+        if (m_LoadedChunks.contains(coord))
+            return;
+
+        std::vector<ChunkDecorationInput>            readyDecorations;
+        std::vector<ChunkDependencyGraph::ReadyMesh> readyMeshes;
+        std::vector<ChunkCoord>                      newChunks;
+
+        auto request = [&](const ChunkCoord requested) {
+            if (m_LoadedChunks.contains(requested) || m_ChunksInTerrainGeneration.contains(requested))
+                return;
+
+            if (!TryReinstate(requested, readyDecorations, readyMeshes)) {
+                newChunks.push_back(requested);
+            }
+        };
+
+        request(coord);
+
+        // Its decoration needs the chunks around it generated too, the load range may not cover them.
+        if (!m_LoadedChunks.contains(coord)) {
+            for (const ChunkCoord offset : ChunkDecorationInput::c_NeighborOffsets) {
+                request(ChunkCoord{ coord.X + offset.X, coord.Z + offset.Z });
+            }
+        }
+
+        m_DependencyGraph.Track(newChunks);
+        SubmitTerrainJobs(newChunks, JobPriority::Normal);
+        SubmitDecorationJobs(readyDecorations);
+        SubmitMeshJobs(readyMeshes);
+    }
+
+    void ChunkManager::ResolveWaiters(ChunkCoord coord, const std::shared_ptr<Chunk>& chunk, ChunkStage reached) {
+        auto it = m_ChunkWaiters.find(coord);
+        if (it == m_ChunkWaiters.end())
+            return;
+
+        std::vector<ChunkWaiter>& waiters = it->second;
+
+        // Only queued here, resuming now could re-enter the manager in the middle of an update.
+        std::erase_if(waiters, [&](ChunkWaiter& waiter) {
+            if (chunk && waiter.Request->m_Stage > reached)
+                return false;
+
+            waiter.Request->m_Result = chunk;
+            m_ReadyWaiters.push_back(waiter);
+            return true;
+        });
+
+        if (waiters.empty()) {
+            m_ChunkWaiters.erase(it);
+        }
+    }
+
+    void ChunkManager::ResumeReadyWaiters() {
+        if (m_ReadyWaiters.empty())
+            return;
+
+        // Nothing is resumed on this thread, new requests of the resumed coroutines go through the inbox.
+        for (ChunkWaiter& waiter : m_ReadyWaiters) {
+            if (waiter.Request->m_ResumeOn == ResumeOn::Worker) {
+                // Rejected or discarded when the pool is stopping, the frame is destroyed with the job.
+                auto coroutine = std::make_shared<SuspendedCoroutine>(waiter.Handle);
+                (void)m_JobSystem.Submit(JobKind::Continuation, JobPriority::High, [coroutine] { coroutine->Resume(); });
+                continue;
+            }
+
+            m_MainThreadWork.Resumes.push_back(waiter.Handle);
+        }
+
+        m_ReadyWaiters.clear();
+    }
 
-        return chunks;
+    void ChunkRequest::await_suspend(std::coroutine_handle<> handle) {
+        m_Manager.PostRequest(*this, handle);
     }
 
 }
@@ -9,103 +9,338 @@
 
 #include "Chunk/Chunk.h"
 #include "Chunk/ChunkNeighbor.h"
-#include "Utils/TaskProcessorPool.h"
-#include "Utils/ThreadSafeVector.h"
+#include "Utils/JobSystem.h"
+#include "Utils/MpscChannel.h"
+#include "Utils/DeferredReclaimer.h"
 #include "TerrainGeneration/TerrainGenerator.h"
 #include "Chunk/ChunkMeshGenerator.h"
+#include "ChunkCache.h"
+#include "ChunkDependencyGraph.h"
+#include "StreamingLookAhead.h"
 
 #include <glm/glm.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <coroutine>
+#include <deque>
+#include <iterator>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 #include <optional>
+#include <span>
+#include <vector>
 
 
 namespace Mct {
 
+	// Time from a chunk being requested until its first mesh reached the main thread.
+	struct MeshLatencyStats {
+		float    LastMs       = 0.0f;
+		float    AverageMs    = 0.0f;
+		float    MaxMs        = 0.0f;
+		uint64_t MeshedChunks = 0;
+	};
+
+	// Capacity of each stage of the chunk pipeline. A stage holds work back while the stage after it
+	// is full, which keeps the chunks and meshes in flight bounded however fast the player moves.
+	struct ChunkPipelineLimits {
+		size_t TerrainChunks  = 256;   // Chunks of terrain jobs queued in the JobSystem or running.
+		size_t ParkedMeshes   = 256;   // Chunks ready for meshing but held back, terrain stalls beyond it.
+		size_t MeshJobs       = 64;    // Mesh jobs queued or running, plus their results not yet integrated.
+		size_t PendingUploads = 192;   // Mesh jobs in flight plus CPU meshes the renderer didn't upload yet.
+	};
+
+	struct ChunkPipelineStats {
+		size_t   TerrainQueued   = 0;   // Requested, waiting for a terrain job slot.
+		size_t   TerrainInFlight = 0;
+		size_t   ParkedMeshes    = 0;
+		size_t   MeshesInFlight  = 0;
+		size_t   PendingUploads  = 0;
+		uint64_t TerrainStalls   = 0;   // Updates which left terrain requests queued for lack of capacity.
+		uint64_t MeshStalls      = 0;   // Ready meshes parked because meshing or upload was full.
+	};
+
+	// Changes to chunk state owned by the main thread (meshes and their GPU allocations), produced by
+	// ChunkManager::Update on the streaming thread and applied in order by the main thread.
+	struct ChunkMainThreadWork {
+		struct MeshUpload {
+			std::shared_ptr<Chunk>     Target;
+			std::unique_ptr<ChunkMesh> Mesh;
+		};
+
+		std::vector<MeshUpload>              Uploads;     // Applied before Evictions.
+		std::vector<std::shared_ptr<Chunk>>  Evictions;   // Unloaded, handed back through ReturnEvictedMesh.
+		std::vector<std::coroutine_handle<>> Resumes;     // ChunkRequests continuing on the main thread.
+
+		[[nodiscard]] bool IsEmpty() const noexcept { return Uploads.empty() && Evictions.empty() && Resumes.empty(); }
+
+		void Append(ChunkMainThreadWork&& other) {
+			std::move(other.Uploads.begin(),   other.Uploads.end(),   std::back_inserter(Uploads));
+			std::move(other.Evictions.begin(), other.Evictions.end(), std::back_inserter(Evictions));
+			std::move(other.Resumes.begin(),   other.Resumes.end(),   std::back_inserter(Resumes));
+			other.Clear();
+		}
+
+		void Clear() noexcept {
+			Uploads.clear();
+			Evictions.clear();
+			Resumes.clear();
+		}
+	};
+
+	// How far a chunk has to progress before a ChunkRequest completes.
+	enum class ChunkStage : uint8_t {
+		Generated,   // Terrain generated and decorated, blocks can be read.
+		Meshed       // CPU mesh built, the chunk gets drawn from the next upload on.
+	};
+
+	// Where the coroutine awaiting a ChunkRequest continues.
+	enum class ResumeOn : uint8_t {
+		MainThread,  // During StreamingCoordinator::SyncMainThread.
+		Worker       // As a job on the world's JobSystem.
+	};
+
+	class ChunkManager;
+
+	// Awaitable returned by ChunkManager::Request, resumes with the chunk once it reached the stage.
+	// Resumes with nullptr when the chunk got unloaded before reaching it.
+	class ChunkRequest {
+	public:
+		ChunkRequest(ChunkManager& manager, ChunkCoord coord, ChunkStage stage, ResumeOn resumeOn) noexcept :
+				m_Manager  ( manager  ),
+				m_Coord    ( coord    ),
+				m_Stage    ( stage    ),
+				m_ResumeOn ( resumeOn )
+		{}
+
+		// The chunk map belongs to the streaming thread, the request always goes through it.
+		bool await_ready() const noexcept { return false; }
+		void await_suspend(std::coroutine_handle<> handle);
+
+		std::shared_ptr<Chunk> await_resume() noexcept { return std::move(m_Result); }
+
+	private:
+		friend class ChunkManager;
+
+		ChunkManager&          m_Manager;
+		ChunkCoord             m_Coord;
+		ChunkStage             m_Stage;
+		ResumeOn               m_ResumeOn;
+		std::shared_ptr<Chunk> m_Result;
+	};
+
+	// Streams chunks in and out around the player.
+	//
+	// Owned by the streaming thread (see StreamingCoordinator), which runs Update. Unless noted
+	// otherwise, methods must only be called from that thread. Everything the main thread has to
+	// do with chunks leaves through TakeMainThreadWork.
+	//
 	class ChunkManager {
 	public:
 		static const Subchunk& GetEmptySubchunk() noexcept { return s_EmptySubchunk; }
 
 	public:
-		ChunkManager(TerrainGenerator generator);
+		ChunkManager(TerrainGenerator generator, JobSystem& jobSystem);
+		~ChunkManager();
 
-		void Update(glm::vec3 playerPos);
+		// playerVelocity (blocks per second) steers the look-ahead cone streamed in front of the player.
+		void Update(glm::vec3 playerPos, glm::vec3 playerVelocity);
 
 		auto& GetChunks() { return m_LoadedChunks; }
 		std::shared_ptr<Chunk> GetChunk(ChunkCoord pos);
 
+		// Any thread. Awaitable completing once the chunk reached the stage, starting its generation
+		// when it is neither loaded nor in flight. Concurrent requests share the same generation.
+		// Chunks outside the load distance still get generated, but are unloaded on the next range
+		// update, and only chunks within the render distance are ever meshed. Completes no earlier
+		// than the next Update.
+		//
+		//     std::shared_ptr<Chunk> chunk = co_await chunkManager.Request(coord, ChunkStage::Meshed);
+		//
+		[[nodiscard]] ChunkRequest Request(ChunkCoord coord, ChunkStage stage, ResumeOn resumeOn = ResumeOn::MainThread) noexcept {
+			return ChunkRequest(*this, coord, stage, resumeOn);
+		}
+
+		// Moves the work produced since the last call to the end of out.
+		void TakeMainThreadWork(ChunkMainThreadWork& out) { out.Append(std::move(m_MainThreadWork)); }
+
+		// Any thread. Returns an evicted chunk with the GPU mesh the main thread took from it (or nullptr).
+		void ReturnEvictedMesh(std::shared_ptr<Chunk> chunk, std::unique_ptr<ChunkGpuMesh> mesh) {
+			m_EvictedMeshes.Push(EvictedMesh{ std::move(chunk), std::move(mesh) });
+		}
+
+		// Any thread. Number of CPU meshes the main thread holds but didn't upload yet.
+		void SetPendingUploadCount(size_t count) noexcept { m_PendingUploadCount.store(count, std::memory_order_relaxed); }
+
+		// Changes whenever a chunk gets loaded or unloaded.
+		[[nodiscard]] uint64_t GetLoadedSetVersion() const noexcept { return m_LoadedSetVersion; }
+
+		[[nodiscard]] const MeshLatencyStats& GetMeshLatencyStats() const noexcept { return m_MeshLatency; }
+
+		[[nodiscard]] const StreamingLookAhead& GetLookAhead() const noexcept { return m_LookAhead; }
+
+		[[nodiscard]] const ChunkCacheStats& GetCacheStats() const noexcept { return m_ChunkCache.GetStats(); }
+
+		// Any thread.
+		[[nodiscard]] ClimateCacheStats GetClimateCacheStats() const { return m_TerrainGenerator.GetClimateCacheStats(); }
+
+		// Refreshed once per Update.
+		[[nodiscard]] const ChunkPipelineStats& GetPipelineStats() const noexcept { return m_PipelineStats; }
+
 	private:
 		void ProcessPendingResults();
+		void AcceptRequests();
 		void LoadChunksInRange(ChunkCoord playerChunkPos);
-		void UnloadOutOfRangeChunks(ChunkCoord playerChunkPos);
+		void UnloadOutOfRangeChunks();
+
+		// Square around the player plus the look-ahead cone.
+		[[nodiscard]] bool IsInLoadRange(ChunkCoord coord)   const noexcept;
+		[[nodiscard]] bool IsInRenderRange(ChunkCoord coord) const noexcept;
+
+		// Queues terrain generation, jobs are submitted by PumpTerrainQueue as capacity allows.
+		void SubmitTerrainJobs(std::span<const ChunkCoord> coords, JobPriority priority);
+		void PumpTerrainQueue();
+		void PumpParkedMeshes();
+
+		// Loads the chunk back from m_ChunkCache, returns false when it isn't cached.
+		bool TryReinstate(ChunkCoord coord, std::vector<ChunkDecorationInput>& outDecorations,
+						  std::vector<ChunkDependencyGraph::ReadyMesh>& outReady);
+
+		// Chunks outside the load range kept for the decoration of an awaited neighbor.
+		[[nodiscard]] bool IsNeededForDecoration(ChunkCoord coord) const noexcept;
 
-		std::optional<ChunkMeshInput> GetChunkMeshInputData(ChunkCoord pos);
+		void RecordMeshLatency(ChunkDependencyGraph::Clock_T::time_point requestTime);
+		void RecordPipelineTimes(const ChunkTimeline& timeline);
 
 	private:
 		static inline std::array<Block, WorldConst::SubchunkBlockCount> s_EmptySubchunkData;
 		static inline Subchunk s_EmptySubchunk{ glm::vec3(0.0f), ChunkManager::s_EmptySubchunkData.data() };
 
 	private:
-		class TerrainGenFunctor {	
-			using ResultVector_T = ThreadSafeVector<std::shared_ptr<Chunk>>;
-
-		public:
-			TerrainGenFunctor(TerrainGenerator& terrainGenerator, ResultVector_T* resultVector) :
-					m_TerrainGenerator ( terrainGenerator ),
-					m_ResultVector     ( resultVector     )
-			{}
-
-			void operator()(ChunkCoord taskChunkCoord) {
-				auto newChunk = std::make_shared<Chunk>(taskChunkCoord);
-				m_TerrainGenerator.GenerateFor(*newChunk);
-				m_ResultVector->Push(std::move(newChunk));
-			}
-
-		private:
-			TerrainGenerator& m_TerrainGenerator;
-			ResultVector_T*   m_ResultVector;        // Points to the result owned by ChunkManager.
+		friend class ChunkRequest;
+
+		struct ChunkWaiter {
+			ChunkRequest*           Request;
+			std::coroutine_handle<> Handle;
+		};
+
+		std::shared_ptr<Chunk> FindChunkAtStage(ChunkCoord coord, ChunkStage stage);
+		void PostRequest(ChunkRequest& request, std::coroutine_handle<> handle);
+		void AddWaiter(const ChunkWaiter& waiter);
+
+		// chunk == nullptr cancels every waiter of the coord.
+		void ResolveWaiters(ChunkCoord coord, const std::shared_ptr<Chunk>& chunk, ChunkStage reached);
+		void ResumeReadyWaiters();
+
+	private:
+		struct EvictedMesh {
+			std::shared_ptr<Chunk>        SourceChunk;
+			std::unique_ptr<ChunkGpuMesh> GpuMesh;
 		};
 
 		struct ChunkMeshGenResult {
-			ChunkCoord                  ChunkCoord;
-			std::unique_ptr<ChunkMesh>  ChunkMesh;
+			std::shared_ptr<Chunk>                    SourceChunk;
+			std::unique_ptr<Mct::ChunkMesh>           ChunkMesh;
+			ChunkDependencyGraph::Clock_T::time_point RequestTime;
 		};
 
-		class ChunkMeshGenFunctor {
-		public:
-			ChunkMeshGenFunctor(ThreadSafeVector<ChunkMeshGenResult>* resultVector) : 
-					m_ResultVector(resultVector)
-			{}
+		struct QueuedTerrain {
+			ChunkCoord                          Coord;
+			ChunkTimeline::Clock_T::time_point  RequestTime;
+		};
 
-			void operator()(ChunkMeshInput meshInput) {
-				std::shared_ptr<Chunk>&    chunk     = meshInput.GetMainChunk();
-				std::unique_ptr<ChunkMesh> chunkMesh = std::make_unique<ChunkMesh>();
+		// Job bodies, run on the worker threads of m_JobSystem. A terrain job generates the queued
+		// chunks of one region tile together.
+		void GenerateTerrainJob(std::span<const QueuedTerrain> queued);
+		void DecorateJob(ChunkDecorationInput& input);
+		void GenerateMeshJob(ChunkDependencyGraph::ReadyMesh& readyMesh);
 
-				ChunkMeshGenerator::GenerateChunkMeshes(*chunkMesh, meshInput);
-				m_ResultVector->Push(ChunkMeshGenResult{chunk->GetCoord(), std::move(chunkMesh)});
-			}
+		// Any thread.
+		void SubmitDecorationJobs(std::span<ChunkDecorationInput> inputs);
 
-		private:
-			// Points to the result owned by ChunkManager.
-			ThreadSafeVector<ChunkMeshGenResult>* m_ResultVector;
-		};
+		// Any thread. Meshes over capacity are parked for PumpParkedMeshes.
+		void SubmitMeshJobs(std::span<ChunkDependencyGraph::ReadyMesh> readyMeshes);
+		bool TryReserveMeshSlot() noexcept;
+		JobSystem::JobDesc MakeMeshJob(ChunkDependencyGraph::ReadyMesh&& readyMesh);
+
+		// Called for every mesh result leaving the pipeline, integrated or dropped.
+		void ReleaseMeshSlot() noexcept { m_MeshJobsInFlight.fetch_sub(1, std::memory_order_relaxed); }
 
 	private:
 		TerrainGenerator m_TerrainGenerator;
 		ChunkCoord       m_PrevPlayerPos;
 
-		std::unordered_set<ChunkCoord>                   m_ChunksInTerrainGeneration;
-		ThreadSafeVector<std::shared_ptr<Chunk>>         m_TerrainGeneratorResults;
-		TaskProcessorPool<ChunkCoord, TerrainGenFunctor> m_TerrainGeneratorPool;
+		// Measured from the timelines of meshed chunks, they size the look-ahead cone.
+		StreamingLookAhead m_LookAhead;
+		float              m_GenerationSecondsEma = 0.02f;
+		float              m_PipelineLatencyEma   = 0.25f;
+
+		// Shared with the rest of the world, terrain and mesh jobs compete in the same worker pool.
+		JobSystem&       m_JobSystem;
+
+		// Schedules decoration jobs as soon as the chunks around a chunk are generated, and mesh jobs
+		// as soon as a chunk and its neighbors are decorated.
+		ChunkDependencyGraph m_DependencyGraph;
+
+		ChunkPipelineLimits m_PipelineLimits;
+		ChunkPipelineStats  m_PipelineStats;
+
+		// Queued, generating or waiting for their decoration, m_QueuedTerrain is the subset still waiting
+		// for a job slot (with their request time). The queues may hold coords which got unloaded, queued
+		// twice or taken along with their region tile, those are skipped when pumped.
+		using QueuedTerrainMap_T = std::unordered_map<ChunkCoord, ChunkTimeline::Clock_T::time_point>;
+
+		std::unordered_set<ChunkCoord>      m_ChunksInTerrainGeneration;
+		QueuedTerrainMap_T                  m_QueuedTerrain;
+		std::deque<QueuedTerrain>           m_UrgentTerrainQueue;
+		std::deque<QueuedTerrain>           m_BackgroundTerrainQueue;
+		std::atomic<size_t>                 m_TerrainChunksInFlight{ 0 };
+		MpscChannel<std::shared_ptr<Chunk>> m_DecoratedChunks{ "DecoratedChunks" };
+
+		// Ready meshes held back by a full meshing or upload stage, parked from any thread.
+		MpscChannel<ChunkDependencyGraph::ReadyMesh> m_ParkedMeshChannel{ "ParkedMeshes" };
+		std::vector<ChunkDependencyGraph::ReadyMesh> m_ParkedMeshes;
+		std::atomic<size_t>                          m_ParkedMeshCount{ 0 };
+		std::atomic<size_t>                          m_MeshJobsInFlight{ 0 };
+		std::atomic<uint64_t>                        m_MeshStalls{ 0 };
+
+		// Reported by the main thread, so meshes integrated during the last frame aren't counted yet.
+		std::atomic<size_t> m_PendingUploadCount{ 0 };
 
-		std::unordered_set<ChunkCoord>                         m_ChunksInMeshGeneration;
-		ThreadSafeVector<ChunkMeshGenResult>                   m_ChunkMeshGenResults;
-		TaskProcessorPool<ChunkMeshInput, ChunkMeshGenFunctor> m_ChunkMeshGenPool;
+		MpscChannel<ChunkMeshGenResult> m_ChunkMeshGenResults{ "MeshGenResults" };
+		MeshLatencyStats                m_MeshLatency;
+
+		// Reused by every drain, so integrating results doesn't allocate once they reached their peak size.
+		std::vector<std::shared_ptr<Chunk>> m_DrainedDecoratedChunks;
+		std::vector<ChunkMeshGenResult>     m_DrainedMeshResults;   // Keeps the meshes of chunks not drained yet.
+
+		std::unordered_map<ChunkCoord, std::vector<ChunkWaiter>> m_ChunkWaiters;
+		std::vector<ChunkWaiter>                                 m_ReadyWaiters;
+
+		// Requests posted from any thread, accepted at the start of Update.
+		std::mutex               m_RequestInboxMutex;
+		std::vector<ChunkWaiter> m_RequestInbox;
+
+		ChunkMainThreadWork         m_MainThreadWork;
+		MpscChannel<EvictedMesh>    m_EvictedMeshes{ "EvictedMeshes" };
+		std::vector<EvictedMesh>    m_DrainedEvictedMeshes;
 
 		// All chunks in memory (Inner renderable + Outer non renderable zones)
 		std::unordered_map<ChunkCoord, std::shared_ptr<Chunk>> m_LoadedChunks;
+		uint64_t                                               m_LoadedSetVersion = 0;
+
+		// Loaded chunks whose mesh was built (and handed to the main thread) or came back from the cache.
+		std::unordered_set<ChunkCoord> m_MeshedChunks;
+
+		// Unloaded chunks and dropped results are freed on a worker, ~Chunk releases ~200 KiB of
+		// blocks and up to 48 GPU handles. Declared before m_ChunkCache, which retires into it.
+		DeferredReclaimer m_Reclaimer;
+
+		// Recently unloaded chunks, compressed and with their GPU meshes.
+		ChunkCache m_ChunkCache;
 	};
 
 }
@@ -0,0 +1,31 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#include "ChunkMapSnapshot.h"
+#include "Utils/Profiler.h"
+
+
+namespace Mct {
+
+    ChunkMapSnapshot::ChunkMapSnapshot(const size_t maxReaders) :
+            m_Epochs    ( maxReaders                  ),
+            m_Current   ( std::make_shared<Version>() ),
+            m_Published ( m_Current.get()             )
+    {}
+
+    void ChunkMapSnapshot::Publish(const Map_T& chunks, const uint64_t version) {
+        MCT_PROFILE_FUNCTION();
+
+        auto next    = std::make_shared<Version>();
+        next->Chunks = chunks;
+        next->Number = version;
+
+        // Unpublished before it is retired, readers entering after the retirement only see the new copy.
+        m_Published.store(next.get(), std::memory_order_seq_cst);
+
+        m_Epochs.Retire(std::move(m_Current));
+        m_Current = std::move(next);
+    }
+
+}
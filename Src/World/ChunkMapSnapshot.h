@@ -0,0 +1,95 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include "Chunk/Chunk.h"
+#include "Chunk/ChunkCoord.h"
+#include "Utils/EpochReclaimer.h"
+#include "Utils/DeferredReclaimer.h"
+#include "Utils/NonCopyable.h"
+#include "Utils/NonMovable.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+
+namespace Mct {
+
+    // Read-only view of the loaded chunks that jobs can query without locks.
+    //
+    // The streaming thread publishes an immutable copy of the chunk map whenever the loaded set
+    // changed. Replaced copies (and with them the last references to unloaded chunks) are reclaimed
+    // through an EpochReclaimer, so a Reader never sees a chunk freed under it.
+    //
+    // Nothing reads it yet, so the ChunkManager doesn't publish one, copying the loaded map would cost
+    // every load and unload for no reader. The first job needing neighbors beyond the dependency
+    // graph's inputs adds it to the ChunkManager, sized from the JobSystem's worker count.
+    //
+    // Usage, from any job:
+    //     ChunkMapSnapshot::Reader chunks = chunkMap.Read();
+    //     if (const Chunk* neighbor = chunks.Find(coord)) { ... }
+    //
+    class ChunkMapSnapshot : public NonCopyable, public NonMovable {
+    public:
+        using Map_T = std::unordered_map<ChunkCoord, std::shared_ptr<Chunk>>;
+
+    private:
+        struct Version {
+            Map_T    Chunks;
+            uint64_t Number = 0;
+        };
+
+    public:
+        // Pins the published map for its lifetime, keep it to the duration of a job. Chunks found
+        // through it have their terrain generated and stay valid while the Reader lives.
+        class Reader : public NonCopyable, public NonMovable {
+        public:
+            [[nodiscard]] const Chunk* Find(ChunkCoord coord) const noexcept {
+                auto it = m_Version->Chunks.find(coord);
+                return it != m_Version->Chunks.end() ? it->second.get() : nullptr;
+            }
+
+            [[nodiscard]] size_t   GetChunkCount() const noexcept { return m_Version->Chunks.size(); }
+            [[nodiscard]] uint64_t GetVersion()    const noexcept { return m_Version->Number; }
+
+        private:
+            friend class ChunkMapSnapshot;
+
+            explicit Reader(const ChunkMapSnapshot& snapshot) noexcept :
+                    m_Guard   ( snapshot.m_Epochs                                    ),
+                    m_Version ( snapshot.m_Published.load(std::memory_order_seq_cst) )
+            {}
+
+        private:
+            EpochReclaimer::ReadGuard m_Guard;
+            const Version*            m_Version;
+        };
+
+    public:
+        // maxReaders: threads reading at once, see EpochReclaimer.
+        explicit ChunkMapSnapshot(size_t maxReaders);
+
+        // Any thread.
+        [[nodiscard]] Reader Read() const noexcept { return Reader(*this); }
+
+        // Streaming thread. Replaces the published map with a copy of chunks.
+        void Publish(const Map_T& chunks, uint64_t version);
+
+        // Streaming thread. Hands the copies no reader can see anymore to reclaimer.
+        void Collect(DeferredReclaimer& reclaimer) { m_Epochs.Collect(reclaimer); }
+
+        // Streaming thread.
+        [[nodiscard]] uint64_t GetPublishedVersion() const noexcept { return m_Current->Number; }
+
+    private:
+        mutable EpochReclaimer      m_Epochs;
+        std::shared_ptr<Version>    m_Current;
+        std::atomic<const Version*> m_Published;
+    };
+
+}
@@ -0,0 +1,87 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#include "ChunkPregenerator.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+
+namespace Mct {
+
+    using Seconds_T = std::chrono::duration<float>;
+
+    std::vector<ChunkPregenerator::Target> ChunkPregenerator::GetSpawnTargets(const ChunkCoord center) {
+        const int loadDist   = WorldConst::LoadDistance;
+        const int renderDist = WorldConst::RenderDistance;
+
+        std::vector<Target> targets;
+        targets.reserve(static_cast<size_t>((2 * loadDist + 1) * (2 * loadDist + 1)));
+
+        for (int dx = -loadDist; dx <= loadDist; ++dx) {
+            for (int dz = -loadDist; dz <= loadDist; ++dz) {
+                const bool inRender = std::abs(dx) <= renderDist && std::abs(dz) <= renderDist;
+
+                targets.push_back(Target{
+                    .Coord { center.X + dx, center.Z + dz },
+                    .Stage { inRender ? ChunkStage::Meshed : ChunkStage::Generated }
+                });
+            }
+        }
+
+        return targets;
+    }
+
+    void ChunkPregenerator::Start(ChunkManager& chunkManager, const std::span<const Target> targets, ChunkCallback_T onChunk) {
+        // Complete before the first request, which may finish right away on another thread.
+        auto state       = std::make_shared<State>();
+        state->Total     = targets.size();
+        state->StartTime = Clock_T::now();
+        state->OnChunk   = std::move(onChunk);
+
+        m_State = state;
+
+        for (const Target& target : targets) {
+            AwaitChunk(chunkManager, target, state);
+        }
+    }
+
+    DetachedTask ChunkPregenerator::AwaitChunk(ChunkManager& chunkManager, const Target target, std::shared_ptr<State> state) {
+        // Resumed on a worker, the main thread may be busy with anything but the ChunkManager.
+        std::shared_ptr<Chunk> chunk = co_await chunkManager.Request(target.Coord, target.Stage, ResumeOn::Worker);
+
+        if (!chunk) {
+            state->Unloaded.fetch_add(1, std::memory_order_relaxed);
+        }
+        else if (state->OnChunk) {
+            state->OnChunk(chunk);
+        }
+
+        if (state->Completed.fetch_add(1, std::memory_order_acq_rel) + 1 == state->Total) {
+            const Clock_T::rep elapsed = (Clock_T::now() - state->StartTime).count();
+            state->FinishTicks.store(std::max<Clock_T::rep>(elapsed, 1), std::memory_order_release);
+        }
+    }
+
+    PregenProgress ChunkPregenerator::GetProgress() const noexcept {
+        if (!m_State)
+            return {};
+
+        PregenProgress progress;
+        progress.Total     = m_State->Total;
+        progress.Completed = m_State->Completed.load(std::memory_order_acquire);
+        progress.Unloaded  = m_State->Unloaded.load(std::memory_order_relaxed);
+
+        const Clock_T::rep finishTicks = m_State->FinishTicks.load(std::memory_order_acquire);
+
+        const Clock_T::duration elapsed = finishTicks ? Clock_T::duration(finishTicks)
+                                                      : Clock_T::now() - m_State->StartTime;
+
+        progress.Seconds         = Seconds_T(elapsed).count();
+        progress.ChunksPerSecond = progress.Seconds > 0.0f ? static_cast<float>(progress.Completed) / progress.Seconds : 0.0f;
+
+        return progress;
+    }
+
+}
@@ -0,0 +1,85 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include "ChunkManager.h"
+#include "Utils/NonCopyable.h"
+#include "Utils/Coroutine.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <span>
+#include <vector>
+
+
+namespace Mct {
+
+    struct PregenProgress {
+        size_t Total           = 0;
+        size_t Completed       = 0;   // Reached their stage, or got unloaded first.
+        size_t Unloaded        = 0;   // Of the completed ones, unloaded before reaching their stage.
+        float  Seconds         = 0.0f;
+        float  ChunksPerSecond = 0.0f;
+
+        [[nodiscard]] bool  IsComplete() const noexcept { return Completed == Total; }
+        [[nodiscard]] float GetFraction() const noexcept {
+            return Total ? static_cast<float>(Completed) / static_cast<float>(Total) : 1.0f;
+        }
+    };
+
+    // Brings a set of chunks through the normal streaming pipeline ahead of time.
+    //
+    // Every target is requested through ChunkManager::Request, so chunks come out exactly like the
+    // player streaming in would produce them. The requests are submitted at once so the pool works
+    // at full width, and the measured chunks per second double as a throughput benchmark of the
+    // whole pipeline. Only chunks within the render distance of the player are ever meshed.
+    //
+    // The ChunkManager still has to be updated (and its meshes consumed) while waiting.
+    //
+    class ChunkPregenerator : public NonCopyable {
+    public:
+        using Clock_T = std::chrono::steady_clock;
+
+        struct Target {
+            ChunkCoord Coord;
+            ChunkStage Stage;
+        };
+
+        // Runs on a worker for every chunk which reached its stage.
+        using ChunkCallback_T = std::function<void(const std::shared_ptr<Chunk>& chunk)>;
+
+        // The load square around center, meshed within the render distance.
+        [[nodiscard]] static std::vector<Target> GetSpawnTargets(ChunkCoord center);
+
+    public:
+        // Any thread. Replaces the progress of a previous Start(), whose requests still complete.
+        void Start(ChunkManager& chunkManager, std::span<const Target> targets, ChunkCallback_T onChunk = {});
+
+        // Any thread. Measured from Start() to the last chunk once complete.
+        [[nodiscard]] PregenProgress GetProgress() const noexcept;
+
+        [[nodiscard]] bool IsStarted() const noexcept { return m_State != nullptr; }
+
+    private:
+        // Shared with the request coroutines, which may outlive this object.
+        struct State {
+            size_t                    Total = 0;
+            Clock_T::time_point       StartTime;
+            ChunkCallback_T           OnChunk;
+            std::atomic<size_t>       Completed{ 0 };
+            std::atomic<size_t>       Unloaded{ 0 };
+            std::atomic<Clock_T::rep> FinishTicks{ 0 };   // Since StartTime, set by the last chunk.
+        };
+
+        static DetachedTask AwaitChunk(ChunkManager& chunkManager, Target target, std::shared_ptr<State> state);
+
+    private:
+        std::shared_ptr<State> m_State;
+    };
+
+}
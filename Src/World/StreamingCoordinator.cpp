@@ -0,0 +1,155 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#include "StreamingCoordinator.h"
+#include "Utils/Profiler.h"
+
+#include <algorithm>
+
+
+namespace Mct {
+
+    using Millis_T = std::chrono::duration<float, std::milli>;
+
+    StreamingCoordinator::StreamingCoordinator(ChunkManager& chunkManager) :
+            m_ChunkManager ( chunkManager                            ),
+            m_Renderable   ( std::make_shared<const RenderableSet>() ),
+            m_Thread       ( &StreamingCoordinator::Run, this        )
+    {}
+
+    StreamingCoordinator::~StreamingCoordinator() {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Stop = true;
+        }
+
+        m_StopCondition.notify_one();
+        m_Thread.join();
+
+        // Coroutines waiting to be resumed here can't be anymore, their frames are freed instead.
+        for (std::coroutine_handle<> handle : m_PendingWork.Resumes) {
+            handle.destroy();
+        }
+    }
+
+    void StreamingCoordinator::SyncMainThread(const glm::vec3 playerPos, const glm::vec3 playerVelocity) {
+        MCT_PROFILE_FUNCTION();
+
+        const auto start = std::chrono::steady_clock::now();
+
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+
+            m_HasPlayer      = true;
+            m_PlayerPos      = playerPos;
+            m_PlayerVelocity = playerVelocity;
+
+            // m_AppliedWork is empty here, swapping keeps the capacity of both batches.
+            std::swap(m_AppliedWork, m_PendingWork);
+
+            // The previous set is released before the evictions below, which still hold its chunks.
+            if (m_PublishedSet) {
+                m_Renderable = std::move(m_PublishedSet);
+            }
+
+            m_Stats = m_PublishedStats;
+        }
+
+        ApplyMainThreadWork();
+        m_LifecycleTracker.Sample();
+
+        m_Stats.SyncMs = Millis_T(std::chrono::steady_clock::now() - start).count();
+    }
+
+    void StreamingCoordinator::ApplyMainThreadWork() {
+        for (ChunkMainThreadWork::MeshUpload& upload : m_AppliedWork.Uploads) {
+            upload.Target->SetMesh(std::move(upload.Mesh));
+            m_AwaitingUpload.push_back(std::move(upload.Target));
+        }
+
+        std::vector<std::unique_ptr<ChunkGpuMesh>> evictedMeshes;
+        evictedMeshes.reserve(m_AppliedWork.Evictions.size());
+
+        for (const std::shared_ptr<Chunk>& chunk : m_AppliedWork.Evictions) {
+            evictedMeshes.push_back(chunk->TakeGpuMesh());
+        }
+
+        // Uploaded by the renderer since the last frame, or evicted (which drops the CPU mesh). Pruned
+        // before the evicted chunks are handed back, so the last reference is never dropped here.
+        std::erase_if(m_AwaitingUpload, [](const std::shared_ptr<Chunk>& chunk) { return !chunk->HaveDirtyMesh(); });
+        m_ChunkManager.SetPendingUploadCount(m_AwaitingUpload.size());
+
+        for (size_t i = 0; i < m_AppliedWork.Evictions.size(); ++i) {
+            m_ChunkManager.ReturnEvictedMesh(std::move(m_AppliedWork.Evictions[i]), std::move(evictedMeshes[i]));
+        }
+
+        for (std::coroutine_handle<> handle : m_AppliedWork.Resumes) {
+            handle.resume();
+        }
+
+        m_AppliedWork.Clear();
+    }
+
+    void StreamingCoordinator::Run() {
+        MCT_PROFILE_THREAD("Streaming");
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+
+        while (!m_StopCondition.wait_for(lock, c_TickInterval, [this] { return m_Stop; })) {
+            // Nothing to stream around before the first frame.
+            if (!m_HasPlayer)
+                continue;
+
+            const glm::vec3 playerPos      = m_PlayerPos;
+            const glm::vec3 playerVelocity = m_PlayerVelocity;
+
+            lock.unlock();
+            Tick(playerPos, playerVelocity);
+            lock.lock();
+        }
+    }
+
+    void StreamingCoordinator::Tick(const glm::vec3 playerPos, const glm::vec3 playerVelocity) {
+        MCT_PROFILE_FUNCTION();
+
+        const auto start = std::chrono::steady_clock::now();
+
+        m_ChunkManager.Update(playerPos, playerVelocity);
+        m_ChunkManager.TakeMainThreadWork(m_TickWork);
+
+        std::shared_ptr<const RenderableSet> snapshot;
+
+        if (m_SnapshotVersion != m_ChunkManager.GetLoadedSetVersion()) {
+            m_SnapshotVersion = m_ChunkManager.GetLoadedSetVersion();
+
+            auto set = std::make_shared<RenderableSet>();
+            set->Chunks.reserve(m_ChunkManager.GetChunks().size());
+
+            for (const auto& [coord, chunk] : m_ChunkManager.GetChunks()) {
+                set->Chunks.push_back(chunk);
+            }
+
+            snapshot = std::move(set);
+        }
+
+        StreamingStats stats;
+        stats.MeshLatency          = m_ChunkManager.GetMeshLatencyStats();
+        stats.Cache                = m_ChunkManager.GetCacheStats();
+        stats.ClimateCache         = m_ChunkManager.GetClimateCacheStats();
+        stats.Pipeline             = m_ChunkManager.GetPipelineStats();
+        stats.LookAheadChunks      = m_ChunkManager.GetLookAhead().GetLookAheadChunks();
+        stats.LookAheadLeadSeconds = m_ChunkManager.GetLookAhead().GetLeadSeconds();
+        stats.TickMs               = Millis_T(std::chrono::steady_clock::now() - start).count();
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        m_PendingWork.Append(std::move(m_TickWork));
+        m_PublishedStats = stats;
+
+        if (snapshot) {
+            m_PublishedSet = std::move(snapshot);
+        }
+    }
+
+}
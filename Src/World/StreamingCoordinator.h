@@ -0,0 +1,108 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include "ChunkManager.h"
+#include "ChunkLifecycleTracker.h"
+#include "Utils/NonCopyable.h"
+#include "Utils/NonMovable.h"
+
+#include <glm/glm.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace Mct {
+
+    // Loaded chunks as seen by one streaming tick. Published by the streaming thread and never
+    // modified afterwards, the renderer iterates it without any locking.
+    struct RenderableSet {
+        std::vector<std::shared_ptr<Chunk>> Chunks;
+    };
+
+    struct StreamingStats {
+        MeshLatencyStats   MeshLatency;
+        ChunkCacheStats    Cache;
+        ClimateCacheStats  ClimateCache;
+        ChunkPipelineStats Pipeline;
+        int                LookAheadChunks      = 0;
+        float              LookAheadLeadSeconds = 0.0f;
+        float              TickMs               = 0.0f;   // Last ChunkManager::Update on the streaming thread.
+        float              SyncMs               = 0.0f;   // Last SyncMainThread, main thread.
+    };
+
+    // Runs the ChunkManager on a dedicated streaming thread.
+    //
+    // The streaming thread owns the chunk map: range scans, neighbor gathering, result integration,
+    // unloading and the chunk cache all happen there, every c_TickInterval. Each tick it publishes a
+    // RenderableSet snapshot when the loaded set changed, and appends the ChunkMainThreadWork it
+    // produced (mesh uploads, evictions, coroutine resumes) to a pending batch. Once per frame the
+    // main thread swaps the batch out under a short lock and applies it, so its share of the world
+    // update stays small and flat however much is being streamed.
+    //
+    class StreamingCoordinator : public NonCopyable, public NonMovable {
+    public:
+        static constexpr auto c_TickInterval = std::chrono::milliseconds(2);
+
+    public:
+        // Starts the streaming thread, chunkManager must outlive this object.
+        explicit StreamingCoordinator(ChunkManager& chunkManager);
+        ~StreamingCoordinator();
+
+        // Main thread, once per frame. Hands the player state to the streaming thread, applies the
+        // work it produced and picks up its latest snapshot and statistics.
+        void SyncMainThread(glm::vec3 playerPos, glm::vec3 playerVelocity);
+
+        // Main thread. Valid until the next SyncMainThread.
+        [[nodiscard]] const RenderableSet&  GetRenderableSet() const noexcept { return *m_Renderable; }
+        [[nodiscard]] const StreamingStats& GetStats()         const noexcept { return m_Stats; }
+
+        // Main thread. The renderer records chunks into it when they are first drawn.
+        [[nodiscard]] ChunkLifecycleTracker& GetLifecycleTracker() noexcept { return m_LifecycleTracker; }
+
+    private:
+        void Run();
+        void Tick(glm::vec3 playerPos, glm::vec3 playerVelocity);
+
+        void ApplyMainThreadWork();
+
+    private:
+        ChunkManager& m_ChunkManager;
+
+        // Shared between the threads, guarded by m_Mutex.
+        std::mutex                           m_Mutex;
+        std::condition_variable              m_StopCondition;
+        bool                                 m_Stop      = false;
+        bool                                 m_HasPlayer = false;
+        glm::vec3                            m_PlayerPos{ 0.0f };
+        glm::vec3                            m_PlayerVelocity{ 0.0f };
+        ChunkMainThreadWork                  m_PendingWork;
+        std::shared_ptr<const RenderableSet> m_PublishedSet;
+        StreamingStats                       m_PublishedStats;
+
+        // Streaming thread only.
+        ChunkMainThreadWork m_TickWork;
+        uint64_t            m_SnapshotVersion = ~uint64_t(0);
+
+        // Main thread only.
+        ChunkMainThreadWork                  m_AppliedWork;
+        std::shared_ptr<const RenderableSet> m_Renderable;
+        StreamingStats                       m_Stats;
+        ChunkLifecycleTracker                m_LifecycleTracker;
+
+        // Meshes handed over but not uploaded yet, their count throttles meshing.
+        std::vector<std::shared_ptr<Chunk>> m_AwaitingUpload;
+
+        // Last, so everything above exists before the thread starts.
+        std::thread m_Thread;
+    };
+
+}
@@ -0,0 +1,82 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#include "StreamingLookAhead.h"
+#include "WorldConstants.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+
+namespace Mct {
+
+    bool StreamingLookAhead::Update(const ChunkCoord playerChunk,
+                                    const glm::vec3  velocity,
+                                    const float      pipelineLatencySeconds,
+                                    const float      chunksPerSecond,
+                                    const int        loadDistance)
+    {
+        const glm::vec2 horizontal = { velocity.x, velocity.z };
+        const float     speed      = glm::length(horizontal);
+
+        int   lookAheadChunks = 0;
+        int   sector          = -1;
+        float leadSeconds     = 0.0f;
+
+        if (speed >= c_MinSpeed) {
+            // Crossing one chunk exposes a full row of new chunks, they all have to be generated.
+            const float rowSeconds = chunksPerSecond > 0.0f
+                                   ? static_cast<float>(2 * loadDistance + 1) / chunksPerSecond
+                                   : 0.0f;
+
+            leadSeconds = pipelineLatencySeconds + rowSeconds;
+
+            const float chunksAhead = speed / static_cast<float>(WorldConst::ChunkSizeX) * leadSeconds;
+            lookAheadChunks = std::clamp(static_cast<int>(std::ceil(chunksAhead)), 0, c_MaxLookAheadChunks);
+
+            const float angle = std::atan2(horizontal.y, horizontal.x) + std::numbers::pi_v<float>;
+            sector = static_cast<int>(angle / (std::numbers::pi_v<float> / 4.0f) + 0.5f) % 8;
+        }
+
+        const bool changed = playerChunk     != m_Apex
+                          || sector          != m_DirectionSector
+                          || lookAheadChunks != m_LookAheadChunks;
+
+        // The cone points at the sector's center, not the exact velocity, so it only moves together
+        // with the changes reported above and load and unload see the cone of the last range update.
+        if (sector != m_DirectionSector && sector >= 0) {
+            const float sectorAngle = static_cast<float>(sector) * (std::numbers::pi_v<float> / 4.0f) - std::numbers::pi_v<float>;
+            m_Direction = { std::cos(sectorAngle), std::sin(sectorAngle) };
+        }
+
+        m_Apex            = playerChunk;
+        m_DirectionSector = sector;
+        m_LookAheadChunks = lookAheadChunks;
+        m_LeadSeconds     = leadSeconds;
+
+        return changed;
+    }
+
+    bool StreamingLookAhead::IsInCone(const ChunkCoord coord, const int baseDistance) const noexcept {
+        if (m_LookAheadChunks == 0)
+            return false;
+
+        const glm::vec2 offset = {
+            static_cast<float>(coord.X - m_Apex.X),
+            static_cast<float>(coord.Z - m_Apex.Z)
+        };
+
+        const float along = glm::dot(offset, m_Direction);
+        if (along <= 0.0f || along > static_cast<float>(baseDistance + m_LookAheadChunks))
+            return false;
+
+        static const float tanHalfAngle = std::tan(c_ConeHalfAngleDeg * std::numbers::pi_v<float> / 180.0f);
+
+        // Widened by one chunk so the tip of the cone isn't a single line of chunks.
+        const float across = glm::length(offset - m_Direction * along);
+        return across <= along * tanHalfAngle + 1.0f;
+    }
+
+}
@@ -0,0 +1,52 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include "Chunk/ChunkCoord.h"
+
+#include <glm/glm.hpp>
+
+
+namespace Mct {
+
+    // Cone of chunks ahead of a moving player which are streamed in before they enter the range.
+    //
+    // The cone starts at the player chunk and points along the horizontal velocity, snapped to one of
+    // 8 directions. Its extra length is how far the player travels while the pipeline produces a
+    // chunk: the measured request to mesh latency, plus the time the workers need to generate one
+    // full row of newly exposed chunks at the measured throughput.
+    //
+    class StreamingLookAhead {
+    public:
+        static constexpr int   c_MaxLookAheadChunks = 8;
+        static constexpr float c_ConeHalfAngleDeg   = 30.0f;
+
+        // Below this horizontal speed (blocks per second) there is no look-ahead.
+        static constexpr float c_MinSpeed = 1.0f;
+
+    public:
+        // Returns true when the cone changed enough that the streamed range must be updated.
+        bool Update(ChunkCoord playerChunk,
+                    glm::vec3  velocity,
+                    float      pipelineLatencySeconds,
+                    float      chunksPerSecond,
+                    int        loadDistance);
+
+        // True when coord lies in the cone, extended baseDistance chunks past the look-ahead.
+        [[nodiscard]] bool IsInCone(ChunkCoord coord, int baseDistance) const noexcept;
+
+        [[nodiscard]] int   GetLookAheadChunks() const noexcept { return m_LookAheadChunks; }
+        [[nodiscard]] float GetLeadSeconds()     const noexcept { return m_LeadSeconds;     }
+
+    private:
+        ChunkCoord m_Apex            = ChunkCoord::MakeInvalid();
+        glm::vec2  m_Direction       = { 0.0f, 0.0f };   // Center of m_DirectionSector.
+        int        m_DirectionSector = -1;               // Velocity quantized to 8 sectors, -1 when standing still.
+        int        m_LookAheadChunks = 0;
+        float      m_LeadSeconds     = 0.0f;
+    };
+
+}
@@ -0,0 +1,489 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#include "BiomeTerrainGen.h"
+#include "TerrainGenerator.h"
+#include "World/Block/Block.h"
+#include "World/Chunk/Chunk.h"
+#include "Utils/Math.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+
+namespace Mct {
+
+	namespace {
+
+		constexpr float c_OceanThreshold  = -0.15f;  // Continentalness below it uses the ocean LUT.
+		constexpr float c_ClimateContrast = 1.6f;    // FBm rarely leaves [-0.6, 0.6], stretch it over the LUTs.
+
+		// Climate noise values mapped into the open (0, 1) range SampleMap expects.
+		float ToLutCoord(const float value) noexcept {
+			return std::clamp(0.5f + 0.5f * c_ClimateContrast * value, 0.001f, 0.999f);
+		}
+
+		uint32_t HashColumn(const int x, const int z, const uint32_t salt) noexcept {
+			uint32_t hash = static_cast<uint32_t>(x) * 0x27d4eb2du ^ static_cast<uint32_t>(z) * 0x165667b1u ^ salt * 0x9e3779b9u;
+			hash ^= hash >> 15;
+			hash *= 0x2c1b3c6du;
+			hash ^= hash >> 12;
+			return hash;
+		}
+
+		// How far a layer's bottom moves in a column, per BiomeLayerBlendMode.
+		int GetLayerVariance(const BiomeLayer& layer, const int x, const int z, const uint32_t layerIndex) noexcept {
+			int amplitude = 0;
+
+			switch (layer.BlendMode) {
+				case BiomeLayerBlendMode::None:          return 0;
+				case BiomeLayerBlendMode::Dither_Low:    amplitude = 1; break;
+				case BiomeLayerBlendMode::Dither_Medium: amplitude = 2; break;
+				case BiomeLayerBlendMode::Dither_High:   amplitude = 5; break;
+				case BiomeLayerBlendMode::Wavy_Strata:
+					return static_cast<int>(std::lround(3.0f * std::sin(0.05f * static_cast<float>(x) + 0.03f * static_cast<float>(z))));
+			}
+
+			const uint32_t span = static_cast<uint32_t>(2 * amplitude + 1);
+			return static_cast<int>(HashColumn(x, z, layerIndex) % span) - amplitude;
+		}
+
+		NoiseSettings ClimateSettings(const int32_t seed, const float frequency, const int octaves) noexcept {
+			return NoiseSettings{
+				.Seed      = seed,
+				.Type      = NoiseType::OpenSimplex2,
+				.Fractal   = FractalType::FBm,
+				.Octaves   = octaves,
+				.Frequency = frequency
+			};
+		}
+
+	}
+
+	BiomeTerrainGen::BiomeTerrainGen(const int32_t seed) :
+			m_TemperatureNoise     ( ClimateSettings(seed + 1, 0.0009f, 3)                     ),
+			m_HumidityNoise        ( ClimateSettings(seed + 2, 0.0013f, 3)                     ),
+			m_ContinentalnessNoise ( ClimateSettings(seed + 3, 0.0006f, 4)                     ),
+			m_TreeSalt             ( HashColumn(seed, 0, 0x7265u)                              ),
+			m_ClimateCache         ( std::make_unique<ClimateCache>(GetClimateCacheCapacity()) )
+	{
+		MCT_ASSERT(BiomeDataManager::GetBiomeCount() > 0, "BiomeDataManager has to be initialized first");
+
+		m_HeightNoise.reserve(BiomeDataManager::GetBiomeCount());
+
+		for (size_t id = 0; id < BiomeDataManager::GetBiomeCount(); ++id) {
+			const BiomeData& biome = BiomeDataManager::GetBiomeData(static_cast<BiomeId>(id));
+
+			m_HeightNoise.emplace_back(NoiseSettings{
+				.Seed      = seed,
+				.Type      = NoiseType::Perlin,
+				.Fractal   = FractalType::FBm,
+				.Octaves   = 4,
+				.Frequency = biome.TerrainRoughness
+			});
+		}
+	}
+
+	void BiomeTerrainGen::GenerateFor(Chunk& chunk) {
+		Chunk* const chunks[] = { &chunk };
+		GenerateRegion(chunks);
+	}
+
+	void BiomeTerrainGen::GenerateRegion(const std::span<Chunk* const> chunks) {
+		if (chunks.empty())
+			return;
+
+		const Area area = MakeArea(chunks);
+
+		Climate climate;
+		SampleClimate(area, climate);
+
+		BiomeWeights weights;
+		ComputeWeights(area, climate, weights);
+
+		ColumnMap heights;
+
+		for (Chunk* const chunk : chunks) {
+			ComputeHeights(area, chunk->GetCoord(), weights, heights);
+			FillChunk(area, climate, heights, *chunk);
+		}
+	}
+
+	BiomeTerrainGen::Area BiomeTerrainGen::MakeArea(const std::span<Chunk* const> chunks) noexcept {
+		ChunkCoord minChunk = chunks.front()->GetCoord();
+		ChunkCoord maxChunk = minChunk;
+
+		for (const Chunk* chunk : chunks) {
+			const ChunkCoord coord = chunk->GetCoord();
+
+			minChunk = { .X = std::min(minChunk.X, coord.X), .Z = std::min(minChunk.Z, coord.Z) };
+			maxChunk = { .X = std::max(maxChunk.X, coord.X), .Z = std::max(maxChunk.Z, coord.Z) };
+		}
+
+		const int innerX = (maxChunk.X - minChunk.X + 1) * c_CellsX + 1;
+		const int innerZ = (maxChunk.Z - minChunk.Z + 1) * c_CellsZ + 1;
+
+		return Area{
+			.MinChunk = minChunk,
+			.InnerX   = innerX,
+			.InnerZ   = innerZ,
+			.OuterX   = innerX + 2 * c_BlendRadius,
+			.OuterZ   = innerZ + 2 * c_BlendRadius
+		};
+	}
+
+	BiomeId BiomeTerrainGen::PickBiome(const float temperature, const float humidity, const float continentalness) noexcept {
+		if (continentalness < c_OceanThreshold)
+			return BiomeDataManager::GetOceanBiomeId(ToLutCoord(temperature), ToLutCoord(humidity));
+
+		return BiomeDataManager::GetLandBiomeId(ToLutCoord(temperature), ToLutCoord(humidity));
+	}
+
+	size_t BiomeTerrainGen::GetClimateCacheCapacity() noexcept {
+		static_assert(c_TileChunks == TerrainGenerator::c_RegionSize, "A region should sample the climate of its own tile");
+
+		// An unaligned load diameter straddles one more tile, the blend margin reaches one further.
+		const int loadTiles = (2 * WorldConst::LoadDistance + 1 + c_TileChunks - 1) / c_TileChunks;
+		const int tiles     = loadTiles + 1 + 2;
+
+		return static_cast<size_t>(tiles * tiles);
+	}
+
+	void BiomeTerrainGen::SampleClimate(const Area& area, Climate& outClimate) const {
+		constexpr int tileSize = ClimateTile::c_Size;
+
+		// Outer grid in world climate samples.
+		const int startX = area.MinChunk.X * c_CellsX - c_BlendRadius;
+		const int startZ = area.MinChunk.Z * c_CellsZ - c_BlendRadius;
+		const int endX   = startX + area.OuterX;
+		const int endZ   = startZ + area.OuterZ;
+
+		const size_t count = static_cast<size_t>(area.OuterX * area.OuterZ);
+
+		outClimate.Temperature    .resize(count);
+		outClimate.Humidity       .resize(count);
+		outClimate.Continentalness.resize(count);
+		outClimate.Biomes         .resize(count);
+
+		for (int tileX = FloorDiv(startX, tileSize); tileX * tileSize < endX; ++tileX) {
+			for (int tileZ = FloorDiv(startZ, tileSize); tileZ * tileSize < endZ; ++tileZ) {
+				const std::shared_ptr<const ClimateTile> tile = GetClimateTile({ .X = tileX * c_TileChunks, .Z = tileZ * c_TileChunks });
+
+				// Overlap of the tile and the outer grid.
+				const int fromX = std::max(startX, tileX * tileSize);
+				const int fromZ = std::max(startZ, tileZ * tileSize);
+				const int toX   = std::min(endX, (tileX + 1) * tileSize);
+				const int toZ   = std::min(endZ, (tileZ + 1) * tileSize);
+
+				for (int x = fromX; x < toX; ++x) {
+					const int src = (x - tileX * tileSize) * tileSize + (fromZ - tileZ * tileSize);
+					const int dst = (x - startX) * area.OuterZ + (fromZ - startZ);
+					const int len = toZ - fromZ;
+
+					std::copy_n(tile->Temperature    .begin() + src, len, outClimate.Temperature    .begin() + dst);
+					std::copy_n(tile->Humidity       .begin() + src, len, outClimate.Humidity       .begin() + dst);
+					std::copy_n(tile->Continentalness.begin() + src, len, outClimate.Continentalness.begin() + dst);
+					std::copy_n(tile->Biomes         .begin() + src, len, outClimate.Biomes         .begin() + dst);
+				}
+			}
+		}
+	}
+
+	std::shared_ptr<const ClimateTile> BiomeTerrainGen::GetClimateTile(const ChunkCoord origin) const {
+		if (std::shared_ptr<const ClimateTile> cached = m_ClimateCache->Find(origin))
+			return cached;
+
+		constexpr float  step = static_cast<float>(c_ClimateStep);
+		constexpr size_t size = static_cast<size_t>(ClimateTile::c_Size);
+
+		const glm::vec3 originPos = origin.ToBlockCoordFloat();
+
+		auto tile = std::make_shared<ClimateTile>();
+
+		m_TemperatureNoise    .FillGrid(originPos.x, originPos.z, size, size, step, tile->Temperature);
+		m_HumidityNoise       .FillGrid(originPos.x, originPos.z, size, size, step, tile->Humidity);
+		m_ContinentalnessNoise.FillGrid(originPos.x, originPos.z, size, size, step, tile->Continentalness);
+
+		for (int i = 0; i < ClimateTile::c_Count; ++i) {
+			tile->Biomes[i] = PickBiome(tile->Temperature[i], tile->Humidity[i], tile->Continentalness[i]);
+		}
+
+		return m_ClimateCache->Insert(origin, std::move(tile));
+	}
+
+	void BiomeTerrainGen::ComputeWeights(const Area& area, const Climate& climate, BiomeWeights& outWeights) {
+		const int outerCount = area.OuterX * area.OuterZ;
+		const int innerCount = area.InnerX * area.InnerZ;
+
+		// Slots in BiomeId order rather than in the order the area meets them, so the heights add the
+		// biomes up in the same order generated alone or within a region.
+		constexpr size_t biomeIdCount = std::numeric_limits<BiomeId>::max() + 1;
+
+		std::array<bool, biomeIdCount> present{};
+		std::array<int,  biomeIdCount> biomeSlots{};
+
+		for (int i = 0; i < outerCount; ++i) {
+			present[climate.Biomes[i]] = true;
+		}
+
+		for (size_t biome = 0; biome < biomeIdCount; ++biome) {
+			if (present[biome]) {
+				biomeSlots[biome] = outWeights.Count++;
+				outWeights.Biomes.push_back(static_cast<BiomeId>(biome));
+			}
+		}
+
+		std::vector<int> slots(static_cast<size_t>(outerCount));
+
+		for (int i = 0; i < outerCount; ++i) {
+			slots[i] = biomeSlots[climate.Biomes[i]];
+		}
+
+		outWeights.Weights.assign(static_cast<size_t>(outWeights.Count * innerCount), 0.0f);
+
+		constexpr int   kernelSize = 2 * c_BlendRadius + 1;
+		constexpr float sampleWeight = 1.0f / (kernelSize * kernelSize);
+
+		// Box filter around every inner sample.
+		for (int x = 0; x < area.InnerX; ++x) {
+			for (int z = 0; z < area.InnerZ; ++z) {
+				for (int dx = 0; dx < kernelSize; ++dx) {
+					for (int dz = 0; dz < kernelSize; ++dz) {
+						const int slot = slots[(x + dx) * area.OuterZ + (z + dz)];
+						outWeights.Weights[slot * innerCount + x * area.InnerZ + z] += sampleWeight;
+					}
+				}
+			}
+		}
+	}
+
+	void BiomeTerrainGen::ComputeHeights(const Area& area, const ChunkCoord coord, const BiomeWeights& weights, ColumnMap& outHeights) const noexcept {
+		outHeights.fill(0.0f);
+
+		const glm::ivec3 chunkPos = coord.ToBlockCoord();
+		const int        innerCount = area.InnerX * area.InnerZ;
+
+		// First inner sample of the chunk.
+		const int firstX = (coord.X - area.MinChunk.X) * c_CellsX;
+		const int firstZ = (coord.Z - area.MinChunk.Z) * c_CellsZ;
+
+		ColumnMap noise;
+
+		for (int slot = 0; slot < weights.Count; ++slot) {
+			const float* slotWeights = weights.Weights.data() + slot * innerCount + firstX * area.InnerZ + firstZ;
+
+			bool present = false;
+			for (int x = 0; x <= c_CellsX && !present; ++x) {
+				for (int z = 0; z <= c_CellsZ && !present; ++z) {
+					present = slotWeights[x * area.InnerZ + z] != 0.0f;
+				}
+			}
+
+			if (!present)
+				continue;
+
+			const BiomeId    biomeId = weights.Biomes[slot];
+			const BiomeData& biome   = BiomeDataManager::GetBiomeData(biomeId);
+
+			m_HeightNoise[biomeId].FillGrid(static_cast<float>(chunkPos.x), static_cast<float>(chunkPos.z),
+											WorldConst::ChunkSizeX, WorldConst::ChunkSizeZ, 1.0f, noise);
+
+			for (size_t x = 0; x < WorldConst::ChunkSizeX; ++x) {
+				const int   cellX = static_cast<int>(x) / c_ClimateStep;
+				const float fracX = static_cast<float>(static_cast<int>(x) % c_ClimateStep) / c_ClimateStep;
+
+				for (size_t z = 0; z < WorldConst::ChunkSizeZ; ++z) {
+					const int   cellZ = static_cast<int>(z) / c_ClimateStep;
+					const float fracZ = static_cast<float>(static_cast<int>(z) % c_ClimateStep) / c_ClimateStep;
+
+					const int   i00  = cellX * area.InnerZ + cellZ;
+					const int   i10  = i00 + area.InnerZ;
+					const float near = slotWeights[i00] + (slotWeights[i00 + 1] - slotWeights[i00]) * fracZ;
+					const float far  = slotWeights[i10] + (slotWeights[i10 + 1] - slotWeights[i10]) * fracZ;
+					const float w    = near + (far - near) * fracX;
+
+					const size_t column = x * WorldConst::ChunkSizeZ + z;
+					outHeights[column] += w * (static_cast<float>(biome.BaseHeight) + biome.HeightAmplitude * noise[column]);
+				}
+			}
+		}
+	}
+
+	void BiomeTerrainGen::FillChunk(const Area& area, const Climate& climate, const ColumnMap& heights, Chunk& chunk) const {
+		const ChunkCoord coord    = chunk.GetCoord();
+		const glm::ivec3 chunkPos = coord.ToBlockCoord();
+
+		// First outer sample inside the chunk.
+		const int firstX = (coord.X - area.MinChunk.X) * c_CellsX + c_BlendRadius;
+		const int firstZ = (coord.Z - area.MinChunk.Z) * c_CellsZ + c_BlendRadius;
+
+		ChunkSpan<Block> blocks     = chunk.GetBlocksForWrite();
+		ChunkHeightmaps& heightmaps = chunk.GetHeightmapsForWrite();
+
+		BiomeMap biomes;
+
+		for (size_t x = 0; x < WorldConst::ChunkSizeX; ++x) {
+			const int   cellX = static_cast<int>(x) / c_ClimateStep;
+			const float fracX = static_cast<float>(static_cast<int>(x) % c_ClimateStep) / c_ClimateStep;
+
+			for (size_t z = 0; z < WorldConst::ChunkSizeZ; ++z) {
+				const int   cellZ = static_cast<int>(z) / c_ClimateStep;
+				const float fracZ = static_cast<float>(static_cast<int>(z) % c_ClimateStep) / c_ClimateStep;
+
+				// Bilinear climate between the 4 inner samples around the column.
+				const auto upsample = [&](const std::vector<float>& map) {
+					const int i00 = (firstX + cellX) * area.OuterZ + (firstZ + cellZ);
+					const int i10 = i00 + area.OuterZ;
+
+					const float near = map[i00] + (map[i00 + 1] - map[i00]) * fracZ;
+					const float far  = map[i10] + (map[i10 + 1] - map[i10]) * fracZ;
+					return near + (far - near) * fracX;
+				};
+
+				const BiomeId biome = PickBiome(upsample(climate.Temperature),
+												upsample(climate.Humidity),
+												upsample(climate.Continentalness));
+
+				const int height = static_cast<int>(std::lround(heights[x * WorldConst::ChunkSizeZ + z]));
+
+				biomes[x * WorldConst::ChunkSizeZ + z] = biome;
+
+				FillColumn(blocks, x, z, height, biome, chunkPos.x + static_cast<int>(x), chunkPos.z + static_cast<int>(z));
+
+				// Nothing is placed above the ground or the water over it.
+				const int top = std::clamp(std::max(height, c_SeaLevel), 0, static_cast<int>(WorldConst::ChunkSizeY) - 1);
+				heightmaps.RebuildColumn(blocks, x, z, static_cast<size_t>(top));
+			}
+		}
+
+		chunk.SetTreeAnchors(PickTrees(coord, biomes, heights, blocks));
+	}
+
+	std::vector<TreeAnchor> BiomeTerrainGen::PickTrees(const ChunkCoord coord, const BiomeMap& biomes, const ColumnMap& heights,
+													   const ChunkSpan<const Block> blocks) const {
+		constexpr int      cellArea  = c_TreeCell * c_TreeCell;
+		constexpr int      maxTrunkY = static_cast<int>(WorldConst::ChunkSizeY) - 1;
+
+		const glm::ivec3 chunkPos = coord.ToBlockCoord();
+
+		std::vector<TreeAnchor> anchors;
+
+		for (int cellX = 0; cellX < static_cast<int>(WorldConst::ChunkSizeX); cellX += c_TreeCell) {
+			for (int cellZ = 0; cellZ < static_cast<int>(WorldConst::ChunkSizeZ); cellZ += c_TreeCell) {
+				// One candidate column per cell, hashed from the cell's world position.
+				const uint32_t hash = HashColumn(chunkPos.x + cellX, chunkPos.z + cellZ, m_TreeSalt);
+				const size_t   x    = static_cast<size_t>(cellX) + hash % c_TreeCell;
+				const size_t   z    = static_cast<size_t>(cellZ) + (hash / c_TreeCell) % c_TreeCell;
+
+				const BiomeData& biome = BiomeDataManager::GetBiomeData(biomes[x * WorldConst::ChunkSizeZ + z]);
+
+				if (biome.TreePalette.empty())
+					continue;
+
+				// The cell stands for cellArea columns, each with the TreeDensity chance.
+				const float roll = static_cast<float>((hash >> 8) & 0xFFFFu) / 65536.0f;
+				if (roll >= biome.TreeDensity * cellArea)
+					continue;
+
+				const int height = static_cast<int>(std::lround(heights[x * WorldConst::ChunkSizeZ + z]));
+				if (height <= c_SeaLevel || height >= maxTrunkY)
+					continue;
+
+				const Block ground = blocks(x, static_cast<size_t>(height), z);
+				if (!ground.IsSolid() || ground.IsWater())
+					continue;
+
+				// The type by the palette weights, from a second hash.
+				const uint32_t pick = HashColumn(chunkPos.x + static_cast<int>(x), chunkPos.z + static_cast<int>(z), m_TreeSalt + 1);
+
+				uint32_t totalWeight = 0;
+				for (const BiomeTreeEntry& entry : biome.TreePalette) {
+					totalWeight += entry.Weight;
+				}
+
+				if (totalWeight == 0)
+					continue;
+
+				uint32_t weight = pick % totalWeight;
+				auto     entry  = biome.TreePalette.begin();
+
+				while (weight >= entry->Weight) {
+					weight -= entry->Weight;
+					++entry;
+				}
+
+				anchors.push_back(TreeAnchor{
+					.X       { static_cast<uint8_t>(x)          },
+					.Z       { static_cast<uint8_t>(z)          },
+					.Y       { static_cast<uint16_t>(height + 1) },
+					.Type    { entry->Type                      },
+					.Variant { static_cast<uint8_t>(pick >> 24) }
+				});
+			}
+		}
+
+		return anchors;
+	}
+
+	void BiomeTerrainGen::FillColumn(ChunkSpan<Block> blocks, const size_t x, const size_t z, int height,
+									 const BiomeId biome, const int worldX, const int worldZ) noexcept {
+		constexpr int maxY = static_cast<int>(WorldConst::ChunkSizeY) - 1;
+
+		height = std::clamp(height, 1, maxY);
+
+		const std::vector<BiomeLayer>& palette = BiomeDataManager::GetBiomeData(biome).BlockPalette;
+
+		// Bottom depth (exclusive) of every layer in this column.
+		std::array<int, 8> layerEnds{};
+		const size_t layerCount = std::min(palette.size(), layerEnds.size());
+
+		for (size_t i = 0, end = 0; i < layerCount; ++i) {
+			const int depth = std::max(1, palette[i].Depth + GetLayerVariance(palette[i], worldX, worldZ, static_cast<uint32_t>(i)));
+			end += static_cast<size_t>(depth);
+			layerEnds[i] = static_cast<int>(end);
+		}
+
+		const auto allowedAt = [](const BiomeLayer& layer, const int y) {
+			// Water in the palette is the ocean floor's cover, never above the sea.
+			if (layer.Block == CoreBlocks::Water && y > c_SeaLevel)
+				return false;
+
+			return layer.MinAllowedY <= y && y <= layer.MaxAllowedY;
+		};
+
+		for (int y = std::min(std::max(height, c_SeaLevel), maxY); y > height; --y) {
+			blocks(x, static_cast<size_t>(y), z) = Block(CoreBlocks::Water);
+		}
+
+		size_t layer = 0;
+
+		for (int y = height; y > 0; --y) {
+			const int depth = height - y;
+
+			while (layer < layerCount && depth >= layerEnds[layer])
+				++layer;
+
+			// A layer outside its Y range gives way to the next one allowed there.
+			BlockId block = CoreBlocks::Stone;
+
+			for (size_t i = layer; i < layerCount; ++i) {
+				if (allowedAt(palette[i], y)) {
+					block = palette[i].Block;
+					break;
+				}
+			}
+
+			// Past the last layer the last one keeps filling.
+			if (layer == layerCount && layerCount > 0 && allowedAt(palette[layerCount - 1], y))
+				block = palette[layerCount - 1].Block;
+
+			blocks(x, static_cast<size_t>(y), z) = Block(block);
+		}
+
+		blocks(x, 0, z) = Block(CoreBlocks::Bedrock);
+	}
+
+}
@@ -0,0 +1,144 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include "World/WorldConstants.h"
+#include "World/Biome/BiomeDataManager.h"
+#include "World/Chunk/ChunkCoord.h"
+#include "World/Chunk/ChunkSpan.h"
+#include "World/Chunk/TreeAnchor.h"
+#include "Noise/BatchedNoise.h"
+#include "ClimateCache.h"
+
+#include <array>
+#include <memory>
+#include <span>
+#include <vector>
+
+
+namespace Mct {
+
+	class Chunk;
+
+	// Terrain shaped by the biomes of BiomeData.yaml.
+	//
+	// Temperature, humidity and continentalness are sampled every c_ClimateStep blocks, over the
+	// generated area plus a c_BlendRadius margin. Each coarse point picks its biome from the land or
+	// ocean climate LUT (by continentalness), and every column gets:
+	//   - its surface biome from the bilinearly upsampled climate, which decides the block palette,
+	//   - its height from the biome heights blended with the box filtered biome weights around it,
+	//     so the ground slopes between biomes instead of stepping at their borders.
+	// Each biome's height noise runs at the biome's TerrainRoughness as its frequency. Trees from the
+	// biome's TreePalette are only anchored here, the ChunkDecorator grows them once the neighbors exist.
+	//
+	// GenerateRegion computes the climate and the blend weights once for a group of chunks, so the
+	// margin around them is sampled and filtered once instead of around every chunk. The samples are
+	// aligned to the world grid, a chunk comes out the same generated alone or within a region.
+	// They come from a ClimateCache of region tiles, so the margin reaching into the neighboring
+	// tiles reuses their samples and biomes once those are generated.
+	//
+	// BiomeDataManager has to be initialized before construction.
+	//
+	class BiomeTerrainGen {
+	public:
+		static constexpr int c_SeaLevel     = 62;
+		static constexpr int c_ClimateStep  = 4;    // Blocks between climate samples.
+		static constexpr int c_BlendRadius  = 2;    // In climate samples, 8 blocks.
+
+		explicit BiomeTerrainGen(int32_t seed);
+
+		void GenerateFor(Chunk& chunk);
+
+		// The 2D fields cover the bounding rectangle of the chunks, meant for chunks of one region tile.
+		void GenerateRegion(std::span<Chunk* const> chunks);
+
+		[[nodiscard]] ClimateCacheStats GetClimateCacheStats() const { return m_ClimateCache->GetStats(); }
+
+	private:
+		static constexpr int c_CellsX = static_cast<int>(WorldConst::ChunkSizeX) / c_ClimateStep;
+		static constexpr int c_CellsZ = static_cast<int>(WorldConst::ChunkSizeZ) / c_ClimateStep;
+
+		static constexpr int c_TileChunks = ClimateTile::c_Size / c_CellsX;   // Chunks per side of a ClimateTile.
+
+		static constexpr int c_TreeCell = 4;    // Blocks, keeps trunks apart.
+
+		static_assert(WorldConst::ChunkSizeX % c_ClimateStep == 0 && WorldConst::ChunkSizeZ % c_ClimateStep == 0);
+		static_assert(WorldConst::ChunkSizeX % c_TreeCell    == 0 && WorldConst::ChunkSizeZ % c_TreeCell    == 0);
+		static_assert(c_CellsX == c_CellsZ && ClimateTile::c_Size % c_CellsX == 0, "Climate tiles hold whole chunks");
+
+		using ColumnMap = std::array<float, WorldConst::ChunkSizeX * WorldConst::ChunkSizeZ>;
+		using BiomeMap  = std::array<BiomeId, WorldConst::ChunkSizeX * WorldConst::ChunkSizeZ>;
+
+		// Rectangle of chunks generated together, with the climate sample grids covering it.
+		struct Area {
+			ChunkCoord MinChunk;
+			int        InnerX;    // Climate samples covering the chunks.
+			int        InnerZ;
+			int        OuterX;    // And the blend margin around them.
+			int        OuterZ;
+
+			[[nodiscard]] float GetOriginX() const noexcept { return static_cast<float>(MinChunk.ToBlockCoord().x); }
+			[[nodiscard]] float GetOriginZ() const noexcept { return static_cast<float>(MinChunk.ToBlockCoord().z); }
+		};
+
+		// Outer grids.
+		struct Climate {
+			std::vector<float>   Temperature;
+			std::vector<float>   Humidity;
+			std::vector<float>   Continentalness;
+			std::vector<BiomeId> Biomes;
+		};
+
+		// Biome weights on the inner climate samples, one row of InnerX * InnerZ per distinct biome.
+		// Every biome of the outer grid gets its row, each sample's weights only depend on the samples
+		// around it whatever else the area holds.
+		struct BiomeWeights {
+			std::vector<BiomeId> Biomes;
+			std::vector<float>   Weights;
+			int                  Count = 0;
+		};
+
+		[[nodiscard]] static Area MakeArea(std::span<Chunk* const> chunks) noexcept;
+
+		[[nodiscard]] static BiomeId PickBiome(float temperature, float humidity, float continentalness) noexcept;
+
+		// Tiles sized to the load radius, plus the ring the blend margin reaches into.
+		[[nodiscard]] static size_t GetClimateCacheCapacity() noexcept;
+
+		// Copies the outer grids out of the cached tiles, computing the missing ones.
+		void SampleClimate(const Area& area, Climate& outClimate) const;
+
+		[[nodiscard]] std::shared_ptr<const ClimateTile> GetClimateTile(ChunkCoord origin) const;
+
+		static void ComputeWeights(const Area& area, const Climate& climate, BiomeWeights& outWeights);
+
+		void ComputeHeights(const Area& area, ChunkCoord coord, const BiomeWeights& weights, ColumnMap& outHeights) const noexcept;
+
+		void FillChunk(const Area& area, const Climate& climate, const ColumnMap& heights, Chunk& chunk) const;
+
+		// At most one tree per c_TreeCell x c_TreeCell columns, with the chance of the biome's TreeDensity
+		// per column, on solid ground above the sea. Grown later by the ChunkDecorator.
+		[[nodiscard]] std::vector<TreeAnchor> PickTrees(ChunkCoord coord, const BiomeMap& biomes, const ColumnMap& heights,
+														ChunkSpan<const Block> blocks) const;
+
+		static void FillColumn(ChunkSpan<Block> blocks, size_t x, size_t z, int height, BiomeId biome, int worldX, int worldZ) noexcept;
+
+	private:
+		BatchedNoise m_TemperatureNoise;
+		BatchedNoise m_HumidityNoise;
+		BatchedNoise m_ContinentalnessNoise;
+
+		// Per BiomeId, at the biome's roughness.
+		std::vector<BatchedNoise> m_HeightNoise;
+
+		// Picks the tree columns, from the seed.
+		uint32_t m_TreeSalt;
+
+		// Behind a pointer, the generator moves into the TerrainGenerator.
+		std::unique_ptr<ClimateCache> m_ClimateCache;
+	};
+
+}
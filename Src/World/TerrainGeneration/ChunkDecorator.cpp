@@ -0,0 +1,140 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#include "ChunkDecorator.h"
+#include "World/Block/Block.h"
+#include "World/Chunk/Chunk.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+
+
+namespace Mct {
+
+	namespace {
+
+		constexpr int c_SizeX = static_cast<int>(WorldConst::ChunkSizeX);
+		constexpr int c_SizeY = static_cast<int>(WorldConst::ChunkSizeY);
+		constexpr int c_SizeZ = static_cast<int>(WorldConst::ChunkSizeZ);
+
+		enum class CanopyShape : uint8_t {
+			None,
+			Round,      // Two wide layers around the top of the trunk, two narrow ones above it.
+			Cone,       // Rings narrowing towards the top, down most of the trunk.
+			Flat        // A wide layer on top of the trunk.
+		};
+
+		struct TreeShape {
+			int         MinTrunk;
+			int         TrunkVariance;  // Up to TrunkVariance - 1 more logs, by the anchor's Variant.
+			CanopyShape Canopy;
+			int         Radius;         // Of the widest leaf layer.
+		};
+
+		// Indexed by TreeType.
+		constexpr std::array<TreeShape, static_cast<size_t>(TreeType::COUNT)> c_TreeShapes{ {
+			{ 4,  3, CanopyShape::Round, 2 },   // Oak
+			{ 4,  2, CanopyShape::Round, 3 },   // OakSwamp
+			{ 5,  3, CanopyShape::Round, 2 },   // Birch
+			{ 6,  4, CanopyShape::Cone,  2 },   // Spruce
+			{ 4,  2, CanopyShape::Flat,  3 },   // Acacia
+			{ 7,  4, CanopyShape::Round, 2 },   // Jungle
+			{ 11, 5, CanopyShape::Round, 3 },   // JungleBig
+			{ 1,  2, CanopyShape::None,  0 }    // DeadBush
+		} };
+
+		static_assert(std::ranges::all_of(c_TreeShapes, [](const TreeShape& shape) {
+			return shape.Radius <= ChunkDecorator::c_MaxTreeRadius && shape.TrunkVariance > 0;
+		}));
+
+	}
+
+	void ChunkDecorator::Decorate(ChunkDecorationInput& input) {
+		Chunk& chunk = *input.Main;
+
+		const auto growFrom = [&chunk](const Chunk& source, const ChunkCoord offset) {
+			for (const TreeAnchor& anchor : source.GetTreeAnchors()) {
+				const int trunkX = offset.X * c_SizeX + anchor.X;
+				const int trunkZ = offset.Z * c_SizeZ + anchor.Z;
+
+				// Too far away to reach this chunk.
+				if (trunkX < -c_MaxTreeRadius || trunkX >= c_SizeX + c_MaxTreeRadius ||
+					trunkZ < -c_MaxTreeRadius || trunkZ >= c_SizeZ + c_MaxTreeRadius)
+					continue;
+
+				GrowTree(chunk, trunkX, trunkZ, anchor);
+			}
+		};
+
+		growFrom(chunk, ChunkCoord{ 0, 0 });
+
+		for (size_t i = 0; i < input.Neighbors.size(); ++i) {
+			growFrom(*input.Neighbors[i], ChunkDecorationInput::c_NeighborOffsets[i]);
+		}
+	}
+
+	void ChunkDecorator::GrowTree(Chunk& chunk, const int trunkX, const int trunkZ, const TreeAnchor& anchor) noexcept {
+		const TreeShape& shape = c_TreeShapes[static_cast<size_t>(anchor.Type)];
+
+		const int baseY = anchor.Y;
+		const int topY  = baseY + shape.MinTrunk + anchor.Variant % shape.TrunkVariance - 1;   // Highest log.
+
+		const auto place = [&chunk](const int x, const int y, const int z, const BlockId type) {
+			if (x < 0 || x >= c_SizeX || y < 0 || y >= c_SizeY || z < 0 || z >= c_SizeZ)
+				return;
+
+			const size_t  bx      = static_cast<size_t>(x);
+			const size_t  by      = static_cast<size_t>(y);
+			const size_t  bz      = static_cast<size_t>(z);
+			const BlockId current = chunk.GetBlock(bx, by, bz).GetType();
+
+			if (current == CoreBlocks::Air || (type == CoreBlocks::Log && current == CoreBlocks::Leaves)) {
+				chunk.SetBlock(bx, by, bz, Block(type));
+			}
+		};
+
+		// Square layer of leaves, without its corners it looks round.
+		const auto leafLayer = [&](const int y, const int radius) {
+			for (int dx = -radius; dx <= radius; ++dx) {
+				for (int dz = -radius; dz <= radius; ++dz) {
+					if (radius > 0 && std::abs(dx) == radius && std::abs(dz) == radius)
+						continue;
+
+					place(trunkX + dx, y, trunkZ + dz, CoreBlocks::Leaves);
+				}
+			}
+		};
+
+		switch (shape.Canopy) {
+			case CanopyShape::Round:
+				leafLayer(topY - 2, shape.Radius);
+				leafLayer(topY - 1, shape.Radius);
+				leafLayer(topY,     shape.Radius - 1);
+				leafLayer(topY + 1, shape.Radius - 1);
+				break;
+
+			case CanopyShape::Cone:
+				// Every other ring steps back in, down to two logs above the ground.
+				for (int y = topY + 1, ring = 0; y >= baseY + 2; --y, ++ring) {
+					const int radius = std::min(shape.Radius, (ring + 1) / 2) - (ring > 2 && ring % 2 == 0 ? 1 : 0);
+					leafLayer(y, radius);
+				}
+				break;
+
+			case CanopyShape::Flat:
+				leafLayer(topY + 1, shape.Radius);
+				leafLayer(topY + 2, shape.Radius - 1);
+				break;
+
+			case CanopyShape::None:
+				break;
+		}
+
+		for (int y = baseY; y <= topY; ++y) {
+			place(trunkX, y, trunkZ, CoreBlocks::Log);
+		}
+	}
+
+}
@@ -0,0 +1,36 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include "World/Chunk/ChunkNeighbor.h"
+#include "World/Chunk/TreeAnchor.h"
+
+
+namespace Mct {
+
+	class Chunk;
+
+	// Second generation stage, grows the trees the terrain generator anchored.
+	//
+	// A chunk is decorated once the chunks around it are generated, with the trees anchored in all
+	// nine of them, clipped to the chunk. The decoration only writes into its own chunk: a tree across
+	// a border is grown piece by piece by every chunk it reaches, from the same anchor. Logs replace
+	// air and leaves and leaves only replace air, so overlapping trees give the same blocks in any
+	// order, and no chunk is written after its decoration.
+	//
+	class ChunkDecorator {
+	public:
+		// Farthest a canopy reaches from its trunk, the neighbors always cover it.
+		static constexpr int c_MaxTreeRadius = 3;
+
+		static void Decorate(ChunkDecorationInput& input);
+
+	private:
+		// trunkX and trunkZ relative to chunk, they may lie in a neighbor.
+		static void GrowTree(Chunk& chunk, int trunkX, int trunkZ, const TreeAnchor& anchor) noexcept;
+	};
+
+}
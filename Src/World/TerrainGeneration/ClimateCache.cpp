@@ -0,0 +1,64 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#include "ClimateCache.h"
+#include "Utils/Assert.h"
+
+
+namespace Mct {
+
+	ClimateCache::ClimateCache(const size_t capacity) :
+			m_Capacity ( capacity )
+	{
+		MCT_ASSERT(capacity > 0, "The climate cache needs room for at least one tile");
+
+		m_Stats.Capacity = capacity;
+		m_Index.reserve(capacity + 1);
+	}
+
+	std::shared_ptr<const ClimateTile> ClimateCache::Find(const ChunkCoord origin) {
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		const auto it = m_Index.find(origin);
+
+		if (it == m_Index.end()) {
+			++m_Stats.Misses;
+			return nullptr;
+		}
+
+		++m_Stats.Hits;
+		m_Entries.splice(m_Entries.begin(), m_Entries, it->second);
+
+		return it->second->Tile;
+	}
+
+	std::shared_ptr<const ClimateTile> ClimateCache::Insert(const ChunkCoord origin, std::shared_ptr<const ClimateTile> tile) {
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		if (const auto it = m_Index.find(origin); it != m_Index.end()) {
+			m_Entries.splice(m_Entries.begin(), m_Entries, it->second);
+			return it->second->Tile;
+		}
+
+		m_Entries.push_front(Entry{ .Origin = origin, .Tile = std::move(tile) });
+		m_Index.emplace(origin, m_Entries.begin());
+
+		while (m_Entries.size() > m_Capacity) {
+			m_Index.erase(m_Entries.back().Origin);
+			m_Entries.pop_back();
+			++m_Stats.Evictions;
+		}
+
+		m_Stats.Entries = m_Entries.size();
+		m_Stats.Bytes   = m_Entries.size() * sizeof(ClimateTile);
+
+		return m_Entries.front().Tile;
+	}
+
+	ClimateCacheStats ClimateCache::GetStats() const {
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return m_Stats;
+	}
+
+}
@@ -0,0 +1,89 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include "World/Biome/BiomeDataManager.h"
+#include "World/Chunk/ChunkCoord.h"
+#include "Utils/NonCopyable.h"
+#include "Utils/NonMovable.h"
+
+#include <array>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+
+namespace Mct {
+
+	// Coarse climate samples of one region tile and the biome each of them picked. Immutable once
+	// cached, the generation jobs holding it read it without locking.
+	struct ClimateTile {
+		static constexpr int c_Size  = 16;   // Samples per side.
+		static constexpr int c_Count = c_Size * c_Size;
+
+		// Sample (x, z) at [x * c_Size + z].
+		std::array<float, c_Count>   Temperature;
+		std::array<float, c_Count>   Humidity;
+		std::array<float, c_Count>   Continentalness;
+		std::array<BiomeId, c_Count> Biomes;
+	};
+
+	struct ClimateCacheStats {
+		size_t   Entries   = 0;
+		size_t   Capacity  = 0;
+		size_t   Bytes     = 0;   // Tiles only, the index's own allocations aren't counted.
+		uint64_t Hits      = 0;
+		uint64_t Misses    = 0;
+		uint64_t Evictions = 0;
+
+		[[nodiscard]] float GetHitRate() const noexcept {
+			const uint64_t lookups = Hits + Misses;
+			return lookups > 0 ? static_cast<float>(Hits) / static_cast<float>(lookups) : 0.0f;
+		}
+	};
+
+	// LRU cache of ClimateTiles keyed by region tile origin, shared by every generation job.
+	//
+	// A region samples its climate with a blend margin reaching into the tiles around it, without the
+	// cache every tile was sampled once for itself and again for each neighbor generated. Sized from
+	// the load radius, tiles the player walked away from are evicted first.
+	//
+	// Thread safe. Tiles are computed by the caller outside the lock, two jobs missing the same tile
+	// at once both compute it and the first one inserted is kept.
+	//
+	class ClimateCache : public NonCopyable, public NonMovable {
+	public:
+		explicit ClimateCache(size_t capacity);
+
+		// The cached tile, nullptr when it has to be computed.
+		[[nodiscard]] std::shared_ptr<const ClimateTile> Find(ChunkCoord origin);
+
+		// Caches tile unless another job got there first, returns the one cached.
+		std::shared_ptr<const ClimateTile> Insert(ChunkCoord origin, std::shared_ptr<const ClimateTile> tile);
+
+		[[nodiscard]] ClimateCacheStats GetStats() const;
+
+	private:
+		struct Entry {
+			ChunkCoord                         Origin;
+			std::shared_ptr<const ClimateTile> Tile;
+		};
+
+		using EntryList_T = std::list<Entry>;
+
+	private:
+		mutable std::mutex m_Mutex;
+		size_t             m_Capacity;
+		ClimateCacheStats  m_Stats;
+
+		// Most recently used at the front.
+		EntryList_T                                           m_Entries;
+		std::unordered_map<ChunkCoord, EntryList_T::iterator> m_Index;
+	};
+
+}
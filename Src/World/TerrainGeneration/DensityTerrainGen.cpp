@@ -0,0 +1,287 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#include "DensityTerrainGen.h"
+#include "World/Block/Block.h"
+#include "World/Chunk/Chunk.h"
+
+#include <algorithm>
+#include <cmath>
+
+
+namespace Mct {
+
+	namespace {
+
+		constexpr float c_BaseHeight       = 70.0f;
+		constexpr float c_SurfaceAmplitude = 36.0f;
+
+		// Blocks from the surface over which the overhang noise fades out, beyond them the density
+		// is the plain distance to the surface and its sign needs no 3D noise.
+		constexpr float c_OverhangRange    = 16.0f;
+		constexpr float c_OverhangStrength = 1.5f;
+
+		constexpr float c_TunnelRadius     = 0.15f;    // In noise units.
+		constexpr float c_TunnelScale      = 4.0f;     // Density slope at the tunnel walls.
+		constexpr float c_TunnelStretchY   = 0.6f;     // Squashes the noise vertically, taller tunnels.
+		constexpr float c_CaveMinY         = 5.0f;     // Keeps the bedrock floor whole.
+
+		FastNoiseLite MakeNoise3D(const int32_t seed, const float frequency, const int octaves) {
+			FastNoiseLite noise(seed);
+			noise.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2);
+			noise.SetFrequency(frequency);
+
+			if (octaves > 1) {
+				noise.SetFractalType(FastNoiseLite::FractalType_FBm);
+				noise.SetFractalOctaves(octaves);
+			}
+
+			return noise;
+		}
+
+	}
+
+	DensityTerrainGen::DensityTerrainGen(const int32_t seed) :
+			m_SurfaceNoise  ( NoiseSettings{
+				.Seed      = seed + 10,
+				.Type      = NoiseType::OpenSimplex2,
+				.Fractal   = FractalType::FBm,
+				.Octaves   = 5,
+				.Frequency = 0.0025f
+			}),
+			m_OverhangNoise ( MakeNoise3D(seed + 11, 0.02f,  2) ),
+			m_TunnelNoiseA  ( MakeNoise3D(seed + 12, 0.012f, 1) ),
+			m_TunnelNoiseB  ( MakeNoise3D(seed + 13, 0.012f, 1) )
+	{}
+
+	void DensityTerrainGen::GenerateFor(Chunk& chunk) {
+		const glm::ivec3 chunkPos = chunk.GetCoord().ToBlockCoord();
+		const float      originX  = static_cast<float>(chunkPos.x);
+		const float      originZ  = static_cast<float>(chunkPos.z);
+
+		SurfaceMap surface;
+		SampleSurface(originX, originZ, surface);
+
+		DensityMap density;
+		SampleDensity(originX, originZ, surface, density);
+
+		ChunkSpan<Block> blocks = chunk.GetBlocksForWrite();
+
+		std::array<SubchunkFill, WorldConst::SubchunkCount> fills;
+
+		for (size_t subchunk = 0; subchunk < WorldConst::SubchunkCount; ++subchunk) {
+			fills[subchunk] = FillSubchunk(density, static_cast<int>(subchunk), blocks.GetSubchunkForWrite(subchunk));
+		}
+
+		FinishColumns(surface, fills, blocks);
+
+		// Only water reaches above the highest subchunk with ground.
+		int top = c_SeaLevel;
+
+		for (int subchunk = static_cast<int>(WorldConst::SubchunkCount) - 1; subchunk >= 0; --subchunk) {
+			if (fills[subchunk] != SubchunkFill::Air) {
+				top = std::max(top, (subchunk + 1) * static_cast<int>(WorldConst::SubchunkSizeY) - 1);
+				break;
+			}
+		}
+
+		ChunkHeightmaps& heightmaps = chunk.GetHeightmapsForWrite();
+
+		for (size_t x = 0; x < WorldConst::ChunkSizeX; ++x) {
+			for (size_t z = 0; z < WorldConst::ChunkSizeZ; ++z) {
+				heightmaps.RebuildColumn(blocks, x, z, static_cast<size_t>(top));
+			}
+		}
+	}
+
+	void DensityTerrainGen::SampleSurface(const float originX, const float originZ, SurfaceMap& outSurface) const noexcept {
+		// The lattice steps differ per axis, only the columns at equal steps go through the grid fill.
+		static_assert(c_LatticeX == c_LatticeZ);
+
+		m_SurfaceNoise.FillGrid(originX, originZ, c_PointsX, c_PointsZ, static_cast<float>(c_LatticeX), outSurface);
+
+		for (float& height : outSurface) {
+			height = c_BaseHeight + c_SurfaceAmplitude * height;
+		}
+	}
+
+	void DensityTerrainGen::SampleDensity(const float originX, const float originZ, const SurfaceMap& surface, DensityMap& outDensity) const noexcept {
+		for (int px = 0; px < c_PointsX; ++px) {
+			const float x = originX + static_cast<float>(px * c_LatticeX);
+
+			for (int pz = 0; pz < c_PointsZ; ++pz) {
+				const float z       = originZ + static_cast<float>(pz * c_LatticeZ);
+				const float height  = surface[px * c_PointsZ + pz];
+
+				for (int py = 0; py < c_PointsY; ++py) {
+					const float y = static_cast<float>(py * c_LatticeY);
+
+					// Positive below the surface, +-1 at c_OverhangRange from it.
+					float density = (height - y) / c_OverhangRange;
+
+					if (std::abs(density) < 1.0f) {
+						density += c_OverhangStrength * m_OverhangNoise.GetNoise(x, y, z) * (1.0f - std::abs(density));
+					}
+
+					if (density > 0.0f && y >= c_CaveMinY) {
+						density = std::min(density, GetCaveDensity(x, y, z));
+					}
+
+					outDensity[PointIndex(px, py, pz)] = density;
+				}
+			}
+		}
+	}
+
+	float DensityTerrainGen::GetCaveDensity(const float x, const float y, const float z) const noexcept {
+		// Both noises are near zero along a curve, the tunnels follow those curves.
+		const float a = m_TunnelNoiseA.GetNoise(x, y * c_TunnelStretchY, z);
+		const float b = m_TunnelNoiseB.GetNoise(x, y * c_TunnelStretchY, z);
+
+		return (std::sqrt(a * a + b * b) - c_TunnelRadius) * c_TunnelScale;
+	}
+
+	DensityTerrainGen::SubchunkFill DensityTerrainGen::FillSubchunk(const DensityMap& density, const int subchunk,
+																	SubchunkSpan<Block> blocks) noexcept {
+		const int firstLayer = subchunk * c_LayersPerSubchunk;
+
+		float minDensity = density[PointIndex(0, firstLayer, 0)];
+		float maxDensity = minDensity;
+
+		for (int px = 0; px < c_PointsX; ++px) {
+			for (int py = firstLayer; py <= firstLayer + c_LayersPerSubchunk; ++py) {
+				for (int pz = 0; pz < c_PointsZ; ++pz) {
+					const float value = density[PointIndex(px, py, pz)];
+
+					minDensity = std::min(minDensity, value);
+					maxDensity = std::max(maxDensity, value);
+				}
+			}
+		}
+
+		// Interpolated values stay within the corners, so the sign is the same everywhere inside.
+		if (maxDensity <= 0.0f)
+			return SubchunkFill::Air;
+
+		if (minDensity > 0.0f) {
+			blocks.Fill(Block(CoreBlocks::Stone));
+			return SubchunkFill::Solid;
+		}
+
+		const Block stone(CoreBlocks::Stone);
+
+		for (int x = 0; x < static_cast<int>(WorldConst::SubchunkSizeX); ++x) {
+			const int   px = x / c_LatticeX;
+			const float tx = static_cast<float>(x % c_LatticeX) / c_LatticeX;
+
+			for (int z = 0; z < static_cast<int>(WorldConst::SubchunkSizeZ); ++z) {
+				const int   pz = z / c_LatticeZ;
+				const float tz = static_cast<float>(z % c_LatticeZ) / c_LatticeZ;
+
+				// Bilinear on the lattice layers of the subchunk first, then linear along the column.
+				std::array<float, c_LayersPerSubchunk + 1> column;
+
+				for (int layer = 0; layer <= c_LayersPerSubchunk; ++layer) {
+					const int   py   = firstLayer + layer;
+					const float d00  = density[PointIndex(px,     py, pz)];
+					const float d01  = density[PointIndex(px,     py, pz + 1)];
+					const float d10  = density[PointIndex(px + 1, py, pz)];
+					const float d11  = density[PointIndex(px + 1, py, pz + 1)];
+					const float near = d00 + (d01 - d00) * tz;
+					const float far  = d10 + (d11 - d10) * tz;
+
+					column[layer] = near + (far - near) * tx;
+				}
+
+				for (int y = 0; y < static_cast<int>(WorldConst::SubchunkSizeY); ++y) {
+					const int   layer = y / c_LatticeY;
+					const float ty    = static_cast<float>(y % c_LatticeY) / c_LatticeY;
+
+					if (column[layer] + (column[layer + 1] - column[layer]) * ty > 0.0f) {
+						blocks(static_cast<size_t>(x), static_cast<size_t>(y), static_cast<size_t>(z)) = stone;
+					}
+				}
+			}
+		}
+
+		return SubchunkFill::Mixed;
+	}
+
+	void DensityTerrainGen::FinishColumns(const SurfaceMap& surface, const std::array<SubchunkFill, WorldConst::SubchunkCount>& fills,
+										  ChunkSpan<Block> blocks) noexcept {
+		constexpr int subchunkSizeY = static_cast<int>(WorldConst::SubchunkSizeY);
+		constexpr int subchunkCount = static_cast<int>(WorldConst::SubchunkCount);
+
+		constexpr int topsoilDepth = 3;
+
+		for (size_t x = 0; x < WorldConst::ChunkSizeX; ++x) {
+			const int   px = static_cast<int>(x) / c_LatticeX;
+			const float tx = static_cast<float>(static_cast<int>(x) % c_LatticeX) / c_LatticeX;
+
+			for (size_t z = 0; z < WorldConst::ChunkSizeZ; ++z) {
+				const int   pz = static_cast<int>(z) / c_LatticeZ;
+				const float tz = static_cast<float>(static_cast<int>(z) % c_LatticeZ) / c_LatticeZ;
+
+				const int   i00    = px * c_PointsZ + pz;
+				const int   i10    = i00 + c_PointsZ;
+				const float near   = surface[i00] + (surface[i00 + 1] - surface[i00]) * tz;
+				const float far    = surface[i10] + (surface[i10 + 1] - surface[i10]) * tz;
+				const int   ground = static_cast<int>(std::floor(near + (far - near) * tx));
+
+				// Open water over the 2D surface, caves below it stay dry.
+				for (int y = c_SeaLevel; y > std::max(ground, 0); --y) {
+					Block& block = blocks(x, static_cast<size_t>(y), z);
+
+					if (block.GetType() == CoreBlocks::Air) {
+						block = Block(CoreBlocks::Water);
+					}
+				}
+
+				// Solid blocks under air get grass, under water dirt, and dirt below them. Subchunks of
+				// buried stone are skipped.
+				bool underAir = true;
+				int  depth    = 0;      // Solid blocks since the last air or water.
+
+				for (int subchunk = subchunkCount - 1; subchunk >= 0; --subchunk) {
+					const int bottomY = subchunk * subchunkSizeY;
+
+					if (fills[subchunk] == SubchunkFill::Air) {
+						underAir = blocks(x, static_cast<size_t>(bottomY), z).GetType() == CoreBlocks::Air;
+						depth    = 0;
+						continue;
+					}
+
+					if (fills[subchunk] == SubchunkFill::Solid && depth >= topsoilDepth)
+						continue;
+
+					for (int y = bottomY + subchunkSizeY - 1; y >= bottomY; --y) {
+						Block&        block = blocks(x, static_cast<size_t>(y), z);
+						const BlockId type  = block.GetType();
+
+						if (type != CoreBlocks::Stone) {
+							underAir = type == CoreBlocks::Air;
+							depth    = 0;
+							continue;
+						}
+
+						// Cave floors deep under the surface stay bare stone.
+						if (y + static_cast<int>(c_OverhangRange) >= ground) {
+							if (depth == 0) {
+								block = Block(underAir ? CoreBlocks::Grass : CoreBlocks::Dirt);
+							}
+							else if (depth < topsoilDepth) {
+								block = Block(CoreBlocks::Dirt);
+							}
+						}
+
+						++depth;
+					}
+				}
+
+				blocks(x, 0, z) = Block(CoreBlocks::Bedrock);
+			}
+		}
+	}
+
+}
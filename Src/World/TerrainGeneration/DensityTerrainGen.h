@@ -0,0 +1,88 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include "World/WorldConstants.h"
+#include "World/Chunk/ChunkSpan.h"
+#include "Noise/BatchedNoise.h"
+
+#include <FastNoiseLite/FastNoiseLite.h>
+
+#include <array>
+
+
+namespace Mct {
+
+	class Chunk;
+	class Block;
+
+	// Terrain from a 3D density function, solid where it's positive, so it can overhang and has caves.
+	//
+	// The density is the distance to a 2D noise surface, warped by 3D noise near it, cut by tunnels
+	// where two 3D noises are both close to zero. It is only evaluated on a coarse lattice, every
+	// c_LatticeX x c_LatticeY x c_LatticeZ blocks, and trilinearly interpolated for the blocks
+	// in between. Far enough from the surface the sign is known without the 3D noise, and a subchunk
+	// whose lattice corners all have the same sign is written in one fill, the interpolated densities
+	// can't change sign inside it.
+	//
+	class DensityTerrainGen {
+	public:
+		static constexpr int c_SeaLevel = 62;
+
+		static constexpr int c_LatticeX = 4;
+		static constexpr int c_LatticeY = 8;
+		static constexpr int c_LatticeZ = 4;
+
+		explicit DensityTerrainGen(int32_t seed);
+
+		void GenerateFor(Chunk& chunk);
+
+	private:
+		static constexpr int c_PointsX = static_cast<int>(WorldConst::ChunkSizeX) / c_LatticeX + 1;
+		static constexpr int c_PointsY = static_cast<int>(WorldConst::ChunkSizeY) / c_LatticeY + 1;
+		static constexpr int c_PointsZ = static_cast<int>(WorldConst::ChunkSizeZ) / c_LatticeZ + 1;
+
+		static constexpr int c_LayersPerSubchunk = static_cast<int>(WorldConst::SubchunkSizeY) / c_LatticeY;
+
+		static_assert(WorldConst::ChunkSizeX    % c_LatticeX == 0 &&
+					  WorldConst::ChunkSizeZ    % c_LatticeZ == 0 &&
+					  WorldConst::SubchunkSizeY % c_LatticeY == 0);
+
+		using SurfaceMap = std::array<float, c_PointsX * c_PointsZ>;
+		using DensityMap = std::array<float, c_PointsX * c_PointsY * c_PointsZ>;
+
+		enum class SubchunkFill : uint8_t {
+			Air,
+			Solid,
+			Mixed
+		};
+
+		[[nodiscard]] static constexpr int PointIndex(const int x, const int y, const int z) noexcept {
+			return (x * c_PointsY + y) * c_PointsZ + z;
+		}
+
+		void  SampleSurface(float originX, float originZ, SurfaceMap& outSurface) const noexcept;
+		void  SampleDensity(float originX, float originZ, const SurfaceMap& surface, DensityMap& outDensity) const noexcept;
+		float GetCaveDensity(float x, float y, float z) const noexcept;
+
+		// Fills the stone of one subchunk, the rest stays air.
+		static SubchunkFill FillSubchunk(const DensityMap& density, int subchunk, SubchunkSpan<Block> blocks) noexcept;
+
+		// Grass and dirt on the ground, water up to the sea level and bedrock at the bottom.
+		static void FinishColumns(const SurfaceMap& surface, const std::array<SubchunkFill, WorldConst::SubchunkCount>& fills,
+								  ChunkSpan<Block> blocks) noexcept;
+
+	private:
+		BatchedNoise m_SurfaceNoise;
+
+		// The lattice is small enough for scalar 3D noise, FastNoiseLite's GetNoise is const and
+		// safe to share between the workers.
+		FastNoiseLite m_OverhangNoise;
+		FastNoiseLite m_TunnelNoiseA;
+		FastNoiseLite m_TunnelNoiseB;
+	};
+
+}
@@ -0,0 +1,69 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#include "HeightfieldTerrainGen.h"
+#include "World/Block/Block.h"
+#include "World/Chunk/Chunk.h"
+
+
+namespace Mct {
+
+	template<typename HeightGraph>
+	HeightfieldTerrainGen<HeightGraph>::HeightfieldTerrainGen(const int32_t seed) noexcept :
+			m_HeightNoise ( seed )
+	{}
+
+	template<typename HeightGraph>
+	void HeightfieldTerrainGen<HeightGraph>::GenerateFor(Chunk& chunk) {
+		const HeightMap  heightMap   = CreateHeightMap(chunk);
+		ChunkSpan<Block> chunkBlocks = chunk.GetBlocksForWrite();
+
+		chunkBlocks.ForEachXYZ([&heightMap](size_t x, size_t y, size_t z, Block& block) {
+			const float terrainHeight = heightMap[x][z];
+
+			if (y > terrainHeight) {
+				block = Block(CoreBlocks::Air);
+			}
+			else if (y == terrainHeight) {
+				block = Block(CoreBlocks::Grass);
+			}
+			else if (y > terrainHeight - 4.0f) {
+				block = Block(CoreBlocks::Dirt);
+			}
+			else {
+				block = Block(CoreBlocks::Stone);
+			}
+		});
+
+		// Grass tops every column, all three heightmaps agree.
+		ChunkHeightmaps& heightmaps = chunk.GetHeightmapsForWrite();
+
+		for (size_t x = 0; x < WorldConst::ChunkSizeX; ++x) {
+			for (size_t z = 0; z < WorldConst::ChunkSizeZ; ++z) {
+				const uint16_t height = static_cast<uint16_t>(heightMap[x][z] + 1.0f);
+
+				for (size_t type = 0; type < static_cast<size_t>(HeightmapType::COUNT); ++type) {
+					heightmaps.Set(static_cast<HeightmapType>(type), x, z, height);
+				}
+			}
+		}
+	}
+
+	template<typename HeightGraph>
+	typename HeightfieldTerrainGen<HeightGraph>::HeightMap HeightfieldTerrainGen<HeightGraph>::CreateHeightMap(Chunk& chunk) const {
+		HeightMap heightMap{};
+
+		const glm::vec3 chunkPos = chunk.GetCoord().ToBlockCoordFloat();
+
+		// The rows are contiguous, the graph writes the heights in place.
+		const std::span<float> heights(heightMap[0].data(), WorldConst::ChunkSizeX * WorldConst::ChunkSizeZ);
+		m_HeightNoise.FillGrid(chunkPos.x, chunkPos.z, WorldConst::ChunkSizeX, WorldConst::ChunkSizeZ, 1.0f, heights);
+
+		return heightMap;
+	}
+
+	template class HeightfieldTerrainGen<NoiseGraph::SimpleTerrainHeight>;
+	template class HeightfieldTerrainGen<NoiseGraph::WarpedTerrainHeight>;
+
+}
@@ -0,0 +1,46 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include "World/WorldConstants.h"
+#include "Noise/FusedNoise.h"
+
+#include <array>
+
+
+namespace Mct {
+
+	class Chunk;
+
+	// Columns of grass, three dirt and stone up to the height HeightGraph gives them.
+	//
+	// HeightGraph is a noise graph (Noise/NoiseGraph.h) giving whole block heights, its parameters
+	// are part of the type and every instantiation gets its own fused height kernel.
+	//
+	template<typename HeightGraph>
+	class HeightfieldTerrainGen {
+		using HeightMap = std::array<std::array<float, WorldConst::ChunkSizeZ>, WorldConst::ChunkSizeX>;
+
+	public:
+		explicit HeightfieldTerrainGen(int32_t seed) noexcept;
+
+		void GenerateFor(Chunk& chunk);
+
+	private:
+		HeightMap CreateHeightMap(Chunk& chunk) const;
+
+	private:
+		// Shared by every worker, built once instead of per chunk.
+		FusedNoise<HeightGraph> m_HeightNoise;
+	};
+
+	extern template class HeightfieldTerrainGen<NoiseGraph::SimpleTerrainHeight>;
+	extern template class HeightfieldTerrainGen<NoiseGraph::WarpedTerrainHeight>;
+
+	using SimpleTerrainGen = HeightfieldTerrainGen<NoiseGraph::SimpleTerrainHeight>;
+	using WarpedTerrainGen = HeightfieldTerrainGen<NoiseGraph::WarpedTerrainHeight>;
+
+}
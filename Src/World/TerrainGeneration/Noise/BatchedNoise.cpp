@@ -0,0 +1,175 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#include "BatchedNoise.h"
+#include "TerrainNoiseGraphs.h"
+#include "Utils/Assert.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+#if defined(MCT_NOISE_X86) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+
+namespace Mct {
+
+	namespace {
+
+		std::atomic<SimdLevel> s_SimdLevelCap{ SimdLevel::Avx2 };
+
+		// One lane, wraps int32 arithmetic like the vector instructions do.
+		struct Scalar {
+			struct F {
+				float v;
+
+				friend F operator+(F a, F b) { return { a.v + b.v }; }
+				friend F operator-(F a, F b) { return { a.v - b.v }; }
+				friend F operator*(F a, F b) { return { a.v * b.v }; }
+			};
+
+			struct I {
+				int32_t v;
+
+				friend I operator+(I a, I b) { return { static_cast<int32_t>(static_cast<uint32_t>(a.v) + static_cast<uint32_t>(b.v)) }; }
+				friend I operator*(I a, I b) { return { static_cast<int32_t>(static_cast<uint32_t>(a.v) * static_cast<uint32_t>(b.v)) }; }
+				friend I operator^(I a, I b) { return { a.v ^ b.v }; }
+				friend I operator&(I a, I b) { return { a.v & b.v }; }
+			};
+
+			struct M {
+				bool v;
+			};
+
+			static constexpr size_t Width = 1;
+
+			static F Set(float value)    { return { value }; }
+			static I SetI(int32_t value) { return { value }; }
+			static F Lanes()             { return { 0.0f }; }
+
+			static F Trunc(F a)          { return { static_cast<float>(static_cast<int32_t>(a.v)) }; }
+			static F Floor(F a)          { const F t = Trunc(a); return { a.v < t.v ? t.v - 1.0f : t.v }; }
+			static F Abs(F a)            { return { std::fabs(a.v) }; }
+			static F Min(F a, F b)       { return { a.v < b.v ? a.v : b.v }; }
+			static F Max(F a, F b)       { return { a.v > b.v ? a.v : b.v }; }
+			static I ToInt(F a)          { return { static_cast<int32_t>(a.v) }; }
+			static I Sra15(I a)          { return { a.v >> 15 }; }
+
+			static M Greater(F a, F b)   { return { a.v > b.v }; }
+			static M Less(F a, F b)      { return { a.v < b.v }; }
+
+			static F Select(M mask, F a, F b)  { return mask.v ? a : b; }
+			static I SelectI(M mask, I a, I b) { return mask.v ? a : b; }
+
+			static void LoadGradients(I index, F& xg, F& yg) {
+				xg = { NoiseKernels::c_Gradients2D[index.v]     };
+				yg = { NoiseKernels::c_Gradients2D[index.v | 1] };
+			}
+
+			static void Store(float* out, F a) { *out = a.v; }
+		};
+
+		SimdLevel DetectSimdLevel() noexcept {
+#if defined(MCT_NOISE_X86) && defined(_MSC_VER)
+			int info[4];
+			__cpuid(info, 0);
+			const int maxLeaf = info[0];
+
+			__cpuid(info, 1);
+			const bool sse41   = (info[2] & (1 << 19)) != 0;
+			const bool osxsave = (info[2] & (1 << 27)) != 0;
+			const bool avx     = (info[2] & (1 << 28)) != 0;
+
+			// The OS has to save the YMM registers too, not only the CPU support them.
+			const bool ymmState = osxsave && (_xgetbv(0) & 0x6) == 0x6;
+
+			bool avx2 = false;
+			if (maxLeaf >= 7) {
+				__cpuidex(info, 7, 0);
+				avx2 = (info[1] & (1 << 5)) != 0;
+			}
+
+			if (avx && avx2 && ymmState)
+				return SimdLevel::Avx2;
+			if (sse41)
+				return SimdLevel::Sse41;
+#elif defined(MCT_NOISE_X86)
+			// Checks the OS enabled the YMM state as well.
+			if (__builtin_cpu_supports("avx2"))
+				return SimdLevel::Avx2;
+			if (__builtin_cpu_supports("sse4.1"))
+				return SimdLevel::Sse41;
+#endif
+			return SimdLevel::Scalar;
+		}
+
+		NoiseGridKernel_T GetKernel(const SimdLevel level) noexcept {
+			switch (level) {
+#if defined(MCT_NOISE_X86)
+				case SimdLevel::Avx2:  return &FillNoiseGridAvx2;
+				case SimdLevel::Sse41: return &FillNoiseGridSse41;
+#endif
+				default:               return &FillNoiseGridScalar;
+			}
+		}
+
+	}
+
+	void FillNoiseGridScalar(const NoiseKernelParams& params, const NoiseGrid2D& grid) {
+		NoiseKernels::FillGridFor<Scalar>(params, grid);
+	}
+
+	NoiseGraphKernel_T GetNoiseGraphKernelScalar(const size_t graphIndex) noexcept {
+		return NoiseKernels::GetGraphKernel<Scalar>(TerrainNoiseGraphs{}, graphIndex);
+	}
+
+	const char* ToString(const SimdLevel level) noexcept {
+		switch (level) {
+			case SimdLevel::Scalar: return "Scalar";
+			case SimdLevel::Sse41:  return "SSE4.1";
+			case SimdLevel::Avx2:   return "AVX2";
+		}
+
+		return "Unknown";
+	}
+
+	BatchedNoise::BatchedNoise(const NoiseSettings& settings, const SimdLevel maxLevel) noexcept :
+			m_Params    { .Settings = settings, .FractalBounding = NoiseKernels::GetFractalBounding(settings) },
+			m_SimdLevel ( std::min(maxLevel, GetSupportedSimdLevel())                                        ),
+			m_Kernel    ( GetKernel(m_SimdLevel)                                                             )
+	{}
+
+	void BatchedNoise::FillGrid(const float originX, const float originZ, const size_t width, const size_t depth,
+								const float step, const std::span<float> out) const noexcept {
+		MCT_ASSERT(out.size() >= width * depth, "Noise grid output is too small");
+
+		m_Kernel(m_Params, NoiseGrid2D{
+			.OriginX = originX,
+			.OriginZ = originZ,
+			.Step    = step,
+			.Width   = width,
+			.Depth   = depth,
+			.Out     = out.data()
+		});
+	}
+
+	float BatchedNoise::GetNoise(const float x, const float z) const noexcept {
+		float value = 0.0f;
+
+		FillNoiseGridScalar(m_Params, NoiseGrid2D{ .OriginX = x, .OriginZ = z, .Width = 1, .Depth = 1, .Out = &value });
+		return value;
+	}
+
+	SimdLevel BatchedNoise::GetSupportedSimdLevel() noexcept {
+		static const SimdLevel s_Level = DetectSimdLevel();
+		return std::min(s_Level, s_SimdLevelCap.load(std::memory_order_relaxed));
+	}
+
+	void BatchedNoise::SetSimdLevelCap(const SimdLevel cap) noexcept {
+		s_SimdLevelCap.store(cap, std::memory_order_relaxed);
+	}
+
+}
@@ -0,0 +1,57 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include "NoiseSettings.h"
+#include "NoiseKernels.h"
+
+#include <span>
+
+
+namespace Mct {
+
+	enum class SimdLevel : uint8_t {
+		Scalar,
+		Sse41,
+		Avx2
+	};
+
+	[[nodiscard]] const char* ToString(SimdLevel level) noexcept;
+
+	// 2D noise evaluated a whole grid at a time.
+	//
+	// Built once from its settings and then only read, so one instance is shared by every worker
+	// generating terrain. Grids are filled by the widest kernel the CPU supports (8 lanes with AVX2,
+	// 4 with SSE4.1), chosen once at construction, with a scalar fallback everywhere else. All the
+	// kernels agree with FastNoiseLite configured the same way, up to float rounding.
+	//
+	class BatchedNoise {
+	public:
+		// maxLevel caps the kernel, e.g. to compare them. It's lowered to what the CPU supports.
+		explicit BatchedNoise(const NoiseSettings& settings = {}, SimdLevel maxLevel = SimdLevel::Avx2) noexcept;
+
+		// Sample (originX + x * step, originZ + z * step) goes to out[x * depth + z].
+		void FillGrid(float originX, float originZ, size_t width, size_t depth, float step, std::span<float> out) const noexcept;
+
+		[[nodiscard]] float GetNoise(float x, float z) const noexcept;
+
+		[[nodiscard]] const NoiseSettings& GetSettings()  const noexcept { return m_Params.Settings; }
+		[[nodiscard]] SimdLevel            GetSimdLevel() const noexcept { return m_SimdLevel; }
+
+		// Detected on first use, lowered by SetSimdLevelCap.
+		[[nodiscard]] static SimdLevel GetSupportedSimdLevel() noexcept;
+
+		// Caps the kernels of every noise built afterwards (FusedNoise too), for the whole process.
+		// Meant for tools comparing the kernels' output, the world must not depend on it.
+		static void SetSimdLevelCap(SimdLevel cap) noexcept;
+
+	private:
+		NoiseKernelParams m_Params;
+		SimdLevel         m_SimdLevel;
+		NoiseGridKernel_T m_Kernel;
+	};
+
+}
@@ -0,0 +1,94 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include "BatchedNoise.h"
+#include "TerrainNoiseGraphs.h"
+#include "Utils/Assert.h"
+
+#include <algorithm>
+#include <span>
+#include <type_traits>
+
+
+namespace Mct {
+
+	// Position of Graph in the list, the list's Count when it's missing.
+	template<typename Graph, typename... Graphs>
+	consteval size_t GetNoiseGraphIndex(NoiseGraphList<Graphs...>) noexcept {
+		constexpr bool matches[] = { std::is_same_v<Graph, Graphs>..., false };
+
+		for (size_t i = 0; i < sizeof...(Graphs); ++i) {
+			if (matches[i])
+				return i;
+		}
+
+		return sizeof...(Graphs);
+	}
+
+	// A noise graph (NoiseGraph.h) evaluated a whole grid at a time by its fused kernel.
+	//
+	// The counterpart of BatchedNoise for composed noise: the widest kernel the CPU supports is
+	// chosen once at construction and one instance is shared by every worker. It holds no settings,
+	// they are all part of the Graph type.
+	//
+	template<typename Graph>
+	class FusedNoise {
+		static constexpr size_t c_GraphIndex = GetNoiseGraphIndex<Graph>(TerrainNoiseGraphs{});
+
+		static_assert(c_GraphIndex < TerrainNoiseGraphs::Count, "List the graph in TerrainNoiseGraphs to compile its kernels");
+
+	public:
+		// maxLevel caps the kernel, e.g. to compare them. It's lowered to what the CPU supports.
+		explicit FusedNoise(const int32_t seed = 0, const SimdLevel maxLevel = SimdLevel::Avx2) noexcept :
+				m_Params    { .Seed = seed                                              },
+				m_SimdLevel ( std::min(maxLevel, BatchedNoise::GetSupportedSimdLevel()) ),
+				m_Kernel    ( GetKernel(m_SimdLevel)                                    )
+		{}
+
+		// Sample (originX + x * step, originZ + z * step) goes to out[x * depth + z].
+		void FillGrid(const float originX, const float originZ, const size_t width, const size_t depth,
+					  const float step, const std::span<float> out) const noexcept {
+			MCT_ASSERT(out.size() >= width * depth, "Noise grid output is too small");
+
+			m_Kernel(m_Params, NoiseGrid2D{
+				.OriginX = originX,
+				.OriginZ = originZ,
+				.Step    = step,
+				.Width   = width,
+				.Depth   = depth,
+				.Out     = out.data()
+			});
+		}
+
+		[[nodiscard]] float GetNoise(const float x, const float z) const noexcept {
+			float value = 0.0f;
+
+			GetNoiseGraphKernelScalar(c_GraphIndex)(m_Params, NoiseGrid2D{ .OriginX = x, .OriginZ = z, .Width = 1, .Depth = 1, .Out = &value });
+			return value;
+		}
+
+		[[nodiscard]] int32_t   GetSeed()      const noexcept { return m_Params.Seed; }
+		[[nodiscard]] SimdLevel GetSimdLevel() const noexcept { return m_SimdLevel; }
+
+	private:
+		static NoiseGraphKernel_T GetKernel(const SimdLevel level) noexcept {
+			switch (level) {
+#if defined(MCT_NOISE_X86)
+				case SimdLevel::Avx2:  return GetNoiseGraphKernelAvx2(c_GraphIndex);
+				case SimdLevel::Sse41: return GetNoiseGraphKernelSse41(c_GraphIndex);
+#endif
+				default:               return GetNoiseGraphKernelScalar(c_GraphIndex);
+			}
+		}
+
+	private:
+		NoiseGraphParams   m_Params;
+		SimdLevel          m_SimdLevel;
+		NoiseGraphKernel_T m_Kernel;
+	};
+
+}
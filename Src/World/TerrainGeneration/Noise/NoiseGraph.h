@@ -0,0 +1,178 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include "NoiseKernels.h"
+
+
+// Noise graphs composed at compile time.
+//
+// A graph is a type built from the nodes below, every parameter a template argument:
+//     Add<Constant<64.0f>, Trunc<Remap<Noise<settings>, -1.0f, 1.0f, 0.0f, 150.0f>>>
+// Each node has a static Eval<V>(params, x, z) over the kernels' vector types, so a whole graph
+// inlines into one loop per instruction set: the octave loops unroll, the settings become immediates
+// and no sample goes through a virtual call or a branch on the graph shape. Changing a parameter
+// means changing the type, which is what a generator wants for settings it never changes at runtime.
+// Only the seed (NoiseGraphParams) is left to runtime, it comes from the world.
+//
+// The kernels of a graph are compiled in the SIMD translation units, a generator's graph has to be
+// listed in TerrainNoiseGraphs (TerrainNoiseGraphs.h) to get them. Same rule as NoiseKernels.h, no
+// standard library templates in here.
+//
+
+
+namespace Mct {
+
+	// What a graph takes at runtime, everything else is part of its type.
+	struct NoiseGraphParams {
+		int32_t Seed = 0;
+	};
+
+	using NoiseGraphKernel_T = void (*)(const NoiseGraphParams& params, const NoiseGrid2D& grid);
+
+	template<typename... Graphs>
+	struct NoiseGraphList {
+		static constexpr size_t Count = sizeof...(Graphs);
+	};
+
+	// Fused kernel of the graph at graphIndex in TerrainNoiseGraphs.
+	NoiseGraphKernel_T GetNoiseGraphKernelScalar(size_t graphIndex) noexcept;
+
+#if defined(MCT_NOISE_X86)
+	NoiseGraphKernel_T GetNoiseGraphKernelSse41(size_t graphIndex) noexcept;
+	NoiseGraphKernel_T GetNoiseGraphKernelAvx2(size_t graphIndex) noexcept;
+#endif
+
+}
+
+
+namespace Mct::NoiseGraph {
+
+	// Single or fractal noise, with the same math as BatchedNoise. Settings.Seed is an offset from
+	// the graph's seed, so the nodes of one graph stay apart.
+	template<NoiseSettings Settings>
+	struct Noise {
+		static constexpr NoiseKernelParams c_Params{
+			.Settings        = Settings,
+			.FractalBounding = NoiseKernels::GetFractalBounding(Settings)
+		};
+
+		template<typename V>
+		static typename V::F Eval(const NoiseGraphParams& params, typename V::F x, typename V::F z) {
+			return NoiseKernels::Sample<V, Settings.Type, Settings.Fractal>(c_Params, params.Seed + Settings.Seed, x, z);
+		}
+	};
+
+	template<float Value>
+	struct Constant {
+		template<typename V>
+		static typename V::F Eval(const NoiseGraphParams&, typename V::F, typename V::F) {
+			return V::Set(Value);
+		}
+	};
+
+	template<typename A, typename B>
+	struct Add {
+		template<typename V>
+		static typename V::F Eval(const NoiseGraphParams& params, typename V::F x, typename V::F z) {
+			return A::template Eval<V>(params, x, z) + B::template Eval<V>(params, x, z);
+		}
+	};
+
+	template<typename A, typename B>
+	struct Mul {
+		template<typename V>
+		static typename V::F Eval(const NoiseGraphParams& params, typename V::F x, typename V::F z) {
+			return A::template Eval<V>(params, x, z) * B::template Eval<V>(params, x, z);
+		}
+	};
+
+	template<typename Source>
+	struct Floor {
+		template<typename V>
+		static typename V::F Eval(const NoiseGraphParams& params, typename V::F x, typename V::F z) {
+			return V::Floor(Source::template Eval<V>(params, x, z));
+		}
+	};
+
+	// Rounds towards zero, like a cast to int.
+	template<typename Source>
+	struct Trunc {
+		template<typename V>
+		static typename V::F Eval(const NoiseGraphParams& params, typename V::F x, typename V::F z) {
+			return V::Trunc(Source::template Eval<V>(params, x, z));
+		}
+	};
+
+	// Maps [InMin, InMax] linearly onto [OutMin, OutMax], values outside aren't clamped.
+	template<typename Source, float InMin, float InMax, float OutMin, float OutMax>
+	struct Remap {
+		static_assert(InMin != InMax, "Remap needs a non empty input range");
+
+		template<typename V>
+		static typename V::F Eval(const NoiseGraphParams& params, typename V::F x, typename V::F z) {
+			const typename V::F t = (Source::template Eval<V>(params, x, z) - V::Set(InMin)) * V::Set(1.0f / (InMax - InMin));
+			return V::Set(OutMin) + t * V::Set(OutMax - OutMin);
+		}
+	};
+
+	// Samples Source at (x, z) moved by WarpX and WarpZ times Amplitude blocks.
+	template<typename Source, typename WarpX, typename WarpZ, float Amplitude>
+	struct DomainWarp {
+		template<typename V>
+		static typename V::F Eval(const NoiseGraphParams& params, typename V::F x, typename V::F z) {
+			const typename V::F amplitude = V::Set(Amplitude);
+
+			const typename V::F warpedX = x + WarpX::template Eval<V>(params, x, z) * amplitude;
+			const typename V::F warpedZ = z + WarpZ::template Eval<V>(params, x, z) * amplitude;
+
+			return Source::template Eval<V>(params, warpedX, warpedZ);
+		}
+	};
+
+	// Low where Selector is below Begin, High above End and smoothstepped in between, e.g. plains
+	// and hills by a continentalness noise. Both sides are always evaluated, lanes don't branch.
+	template<typename Selector, float Begin, float End, typename Low, typename High>
+	struct Blend {
+		static_assert(Begin < End, "Blend needs Begin below End");
+
+		template<typename V>
+		static typename V::F Eval(const NoiseGraphParams& params, typename V::F x, typename V::F z) {
+			using F = typename V::F;
+
+			const F linear = (Selector::template Eval<V>(params, x, z) - V::Set(Begin)) * V::Set(1.0f / (End - Begin));
+			const F t      = V::Min(V::Max(linear, V::Set(0.0f)), V::Set(1.0f));
+			const F smooth = t * t * (V::Set(3.0f) - V::Set(2.0f) * t);
+
+			const F low  = Low::template Eval<V>(params, x, z);
+			const F high = High::template Eval<V>(params, x, z);
+
+			return low + (high - low) * smooth;
+		}
+	};
+
+}
+
+
+namespace Mct::NoiseKernels {
+
+	template<typename V, typename Graph>
+	void FillGraphGrid(const NoiseGraphParams& params, const NoiseGrid2D& grid) {
+		using F = typename V::F;
+
+		FillGridWith<V>(grid, [&params](const F x, const F z) {
+			return Graph::template Eval<V>(params, x, z);
+		});
+	}
+
+	// One fused kernel per graph of the list, indexed like it.
+	template<typename V, typename... Graphs>
+	NoiseGraphKernel_T GetGraphKernel(NoiseGraphList<Graphs...>, const size_t graphIndex) noexcept {
+		static constexpr NoiseGraphKernel_T c_Kernels[] = { &FillGraphGrid<V, Graphs>... };
+		return c_Kernels[graphIndex];
+	}
+
+}
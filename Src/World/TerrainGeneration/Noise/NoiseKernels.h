@@ -0,0 +1,359 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include "NoiseSettings.h"
+
+#include <cstddef>
+#include <cstdint>
+
+
+// Width generic noise kernels, shared by the scalar fallback and the SIMD translation units.
+//
+// Every kernel is a template over a vector type V, which each translation unit defines privately
+// (with its own instruction set flags) as:
+//     V::F, V::I, V::M             float, int32 and mask vectors with +, -, * (F, I) and ^, & (I)
+//     V::Width                     number of lanes
+//     V::Set, V::SetI, V::Lanes    broadcast, and { 0, 1, 2, ... }
+//     V::Floor, V::Trunc, V::Abs, V::Min, V::Max, V::ToInt, V::Select, V::SelectI, V::Greater, V::Less
+//     V::Sra15                     arithmetic shift right by 15
+//     V::LoadGradients             the gradient pair at an even table index
+//     V::Store                     unaligned store of all lanes
+//
+// Keep this header free of standard library templates: it is compiled with different ISA flags and
+// inline functions instantiated in more than one of those would break the one definition rule.
+//
+// The math follows FastNoiseLite step by step, so the scalar path matches it up to float rounding.
+//
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define MCT_NOISE_X86
+#endif
+
+
+namespace Mct {
+
+	struct NoiseKernelParams {
+		NoiseSettings Settings;
+		float         FractalBounding = 1.0f;
+	};
+
+	// Sample (OriginX + x * Step, OriginZ + z * Step) goes to Out[x * Depth + z].
+	struct NoiseGrid2D {
+		float  OriginX = 0.0f;
+		float  OriginZ = 0.0f;
+		float  Step    = 1.0f;
+		size_t Width   = 0;
+		size_t Depth   = 0;
+		float* Out     = nullptr;
+	};
+
+	using NoiseGridKernel_T = void (*)(const NoiseKernelParams& params, const NoiseGrid2D& grid);
+
+	void FillNoiseGridScalar(const NoiseKernelParams& params, const NoiseGrid2D& grid);
+
+#if defined(MCT_NOISE_X86)
+	void FillNoiseGridSse41(const NoiseKernelParams& params, const NoiseGrid2D& grid);
+	void FillNoiseGridAvx2(const NoiseKernelParams& params, const NoiseGrid2D& grid);
+#endif
+
+}
+
+
+namespace Mct::NoiseKernels {
+
+	inline constexpr int32_t c_PrimeX          = 501125321;
+	inline constexpr int32_t c_PrimeY          = 1136930381;
+	inline constexpr int32_t c_HashMultiplier  = 0x27d4eb2d;
+
+	inline constexpr float   c_Sqrt3           = 1.7320508075688772935274463415059f;
+	inline constexpr float   c_SkewF2          = 0.5f * (c_Sqrt3 - 1);
+	inline constexpr float   c_UnskewG2        = (3 - c_Sqrt3) / 6;
+
+	inline constexpr float   c_PerlinScale     = 1.4247691104677813f;
+	inline constexpr float   c_SimplexScale    = 99.83685446303647f;
+
+	// FastNoiseLite's 2D gradients, x and y interleaved.
+	alignas(64) inline constexpr float c_Gradients2D[256] = {
+		0.130526192220052f, 0.99144486137381f, 0.38268343236509f, 0.923879532511287f, 0.608761429008721f, 0.793353340291235f, 0.793353340291235f, 0.608761429008721f,
+		0.923879532511287f, 0.38268343236509f, 0.99144486137381f, 0.130526192220051f, 0.99144486137381f, -0.130526192220051f, 0.923879532511287f, -0.38268343236509f,
+		0.793353340291235f, -0.60876142900872f, 0.608761429008721f, -0.793353340291235f, 0.38268343236509f, -0.923879532511287f, 0.130526192220052f, -0.99144486137381f,
+		-0.130526192220052f, -0.99144486137381f, -0.38268343236509f, -0.923879532511287f, -0.608761429008721f, -0.793353340291235f, -0.793353340291235f, -0.608761429008721f,
+		-0.923879532511287f, -0.38268343236509f, -0.99144486137381f, -0.130526192220052f, -0.99144486137381f, 0.130526192220051f, -0.923879532511287f, 0.38268343236509f,
+		-0.793353340291235f, 0.608761429008721f, -0.608761429008721f, 0.793353340291235f, -0.38268343236509f, 0.923879532511287f, -0.130526192220052f, 0.99144486137381f,
+		0.130526192220052f, 0.99144486137381f, 0.38268343236509f, 0.923879532511287f, 0.608761429008721f, 0.793353340291235f, 0.793353340291235f, 0.608761429008721f,
+		0.923879532511287f, 0.38268343236509f, 0.99144486137381f, 0.130526192220051f, 0.99144486137381f, -0.130526192220051f, 0.923879532511287f, -0.38268343236509f,
+		0.793353340291235f, -0.60876142900872f, 0.608761429008721f, -0.793353340291235f, 0.38268343236509f, -0.923879532511287f, 0.130526192220052f, -0.99144486137381f,
+		-0.130526192220052f, -0.99144486137381f, -0.38268343236509f, -0.923879532511287f, -0.608761429008721f, -0.793353340291235f, -0.793353340291235f, -0.608761429008721f,
+		-0.923879532511287f, -0.38268343236509f, -0.99144486137381f, -0.130526192220052f, -0.99144486137381f, 0.130526192220051f, -0.923879532511287f, 0.38268343236509f,
+		-0.793353340291235f, 0.608761429008721f, -0.608761429008721f, 0.793353340291235f, -0.38268343236509f, 0.923879532511287f, -0.130526192220052f, 0.99144486137381f,
+		0.130526192220052f, 0.99144486137381f, 0.38268343236509f, 0.923879532511287f, 0.608761429008721f, 0.793353340291235f, 0.793353340291235f, 0.608761429008721f,
+		0.923879532511287f, 0.38268343236509f, 0.99144486137381f, 0.130526192220051f, 0.99144486137381f, -0.130526192220051f, 0.923879532511287f, -0.38268343236509f,
+		0.793353340291235f, -0.60876142900872f, 0.608761429008721f, -0.793353340291235f, 0.38268343236509f, -0.923879532511287f, 0.130526192220052f, -0.99144486137381f,
+		-0.130526192220052f, -0.99144486137381f, -0.38268343236509f, -0.923879532511287f, -0.608761429008721f, -0.793353340291235f, -0.793353340291235f, -0.608761429008721f,
+		-0.923879532511287f, -0.38268343236509f, -0.99144486137381f, -0.130526192220052f, -0.99144486137381f, 0.130526192220051f, -0.923879532511287f, 0.38268343236509f,
+		-0.793353340291235f, 0.608761429008721f, -0.608761429008721f, 0.793353340291235f, -0.38268343236509f, 0.923879532511287f, -0.130526192220052f, 0.99144486137381f,
+		0.130526192220052f, 0.99144486137381f, 0.38268343236509f, 0.923879532511287f, 0.608761429008721f, 0.793353340291235f, 0.793353340291235f, 0.608761429008721f,
+		0.923879532511287f, 0.38268343236509f, 0.99144486137381f, 0.130526192220051f, 0.99144486137381f, -0.130526192220051f, 0.923879532511287f, -0.38268343236509f,
+		0.793353340291235f, -0.60876142900872f, 0.608761429008721f, -0.793353340291235f, 0.38268343236509f, -0.923879532511287f, 0.130526192220052f, -0.99144486137381f,
+		-0.130526192220052f, -0.99144486137381f, -0.38268343236509f, -0.923879532511287f, -0.608761429008721f, -0.793353340291235f, -0.793353340291235f, -0.608761429008721f,
+		-0.923879532511287f, -0.38268343236509f, -0.99144486137381f, -0.130526192220052f, -0.99144486137381f, 0.130526192220051f, -0.923879532511287f, 0.38268343236509f,
+		-0.793353340291235f, 0.608761429008721f, -0.608761429008721f, 0.793353340291235f, -0.38268343236509f, 0.923879532511287f, -0.130526192220052f, 0.99144486137381f,
+		0.130526192220052f, 0.99144486137381f, 0.38268343236509f, 0.923879532511287f, 0.608761429008721f, 0.793353340291235f, 0.793353340291235f, 0.608761429008721f,
+		0.923879532511287f, 0.38268343236509f, 0.99144486137381f, 0.130526192220051f, 0.99144486137381f, -0.130526192220051f, 0.923879532511287f, -0.38268343236509f,
+		0.793353340291235f, -0.60876142900872f, 0.608761429008721f, -0.793353340291235f, 0.38268343236509f, -0.923879532511287f, 0.130526192220052f, -0.99144486137381f,
+		-0.130526192220052f, -0.99144486137381f, -0.38268343236509f, -0.923879532511287f, -0.608761429008721f, -0.793353340291235f, -0.793353340291235f, -0.608761429008721f,
+		-0.923879532511287f, -0.38268343236509f, -0.99144486137381f, -0.130526192220052f, -0.99144486137381f, 0.130526192220051f, -0.923879532511287f, 0.38268343236509f,
+		-0.793353340291235f, 0.608761429008721f, -0.608761429008721f, 0.793353340291235f, -0.38268343236509f, 0.923879532511287f, -0.130526192220052f, 0.99144486137381f,
+		0.38268343236509f, 0.923879532511287f, 0.923879532511287f, 0.38268343236509f, 0.923879532511287f, -0.38268343236509f, 0.38268343236509f, -0.923879532511287f,
+		-0.38268343236509f, -0.923879532511287f, -0.923879532511287f, -0.38268343236509f, -0.923879532511287f, 0.38268343236509f, -0.38268343236509f, 0.923879532511287f,
+	};
+
+
+	// FastNoiseLite's CalculateFractalBounding.
+	constexpr float GetFractalBounding(const NoiseSettings& settings) noexcept {
+		const float gain       = settings.Gain < 0.0f ? -settings.Gain : settings.Gain;
+		float       amp        = gain;
+		float       ampFractal = 1.0f;
+
+		for (int i = 1; i < settings.Octaves; ++i) {
+			ampFractal += amp;
+			amp        *= gain;
+		}
+
+		return 1.0f / ampFractal;
+	}
+
+	template<typename V>
+	inline typename V::F Lerp(typename V::F a, typename V::F b, typename V::F t) {
+		return a + t * (b - a);
+	}
+
+	template<typename V>
+	inline typename V::F InterpQuintic(typename V::F t) {
+		return t * t * t * (t * (t * V::Set(6.0f) - V::Set(15.0f)) + V::Set(10.0f));
+	}
+
+	template<typename V>
+	inline typename V::F GradCoord(typename V::I seed, typename V::I xPrimed, typename V::I yPrimed,
+								   typename V::F xd, typename V::F yd) {
+		typename V::I hash = (seed ^ xPrimed ^ yPrimed) * V::SetI(c_HashMultiplier);
+		hash = (hash ^ V::Sra15(hash)) & V::SetI(127 << 1);
+
+		typename V::F xg, yg;
+		V::LoadGradients(hash, xg, yg);
+
+		return xd * xg + yd * yg;
+	}
+
+	template<typename V>
+	inline typename V::F SinglePerlin(typename V::I seed, typename V::F x, typename V::F y) {
+		using F = typename V::F;
+		using I = typename V::I;
+
+		const F xFloor = V::Floor(x);
+		const F yFloor = V::Floor(y);
+
+		const F xd0 = x - xFloor;
+		const F yd0 = y - yFloor;
+		const F xd1 = xd0 - V::Set(1.0f);
+		const F yd1 = yd0 - V::Set(1.0f);
+
+		const F xs = InterpQuintic<V>(xd0);
+		const F ys = InterpQuintic<V>(yd0);
+
+		const I x0 = V::ToInt(xFloor) * V::SetI(c_PrimeX);
+		const I y0 = V::ToInt(yFloor) * V::SetI(c_PrimeY);
+		const I x1 = x0 + V::SetI(c_PrimeX);
+		const I y1 = y0 + V::SetI(c_PrimeY);
+
+		const F xf0 = Lerp<V>(GradCoord<V>(seed, x0, y0, xd0, yd0), GradCoord<V>(seed, x1, y0, xd1, yd0), xs);
+		const F xf1 = Lerp<V>(GradCoord<V>(seed, x0, y1, xd0, yd1), GradCoord<V>(seed, x1, y1, xd1, yd1), xs);
+
+		return Lerp<V>(xf0, xf1, ys) * V::Set(c_PerlinScale);
+	}
+
+	// Expects skewed coordinates, like FastNoiseLite after TransformNoiseCoordinate.
+	template<typename V>
+	inline typename V::F SingleSimplex(typename V::I seed, typename V::F x, typename V::F y) {
+		using F = typename V::F;
+		using I = typename V::I;
+		using M = typename V::M;
+
+		constexpr float G2     = c_UnskewG2;
+		constexpr float cSlope = 2 * (1 - 2 * G2) * (1 / G2 - 2);
+		constexpr float cBase  = -2 * (1 - 2 * G2) * (1 - 2 * G2);
+
+		const F xFloor = V::Floor(x);
+		const F yFloor = V::Floor(y);
+
+		const F xi = x - xFloor;
+		const F yi = y - yFloor;
+
+		const F t  = (xi + yi) * V::Set(G2);
+		const F x0 = xi - t;
+		const F y0 = yi - t;
+
+		const I i = V::ToInt(xFloor) * V::SetI(c_PrimeX);
+		const I j = V::ToInt(yFloor) * V::SetI(c_PrimeY);
+
+		const F zero = V::Set(0.0f);
+		const F half = V::Set(0.5f);
+
+		// Corner falloffs clamp at zero instead of branching, a zero falloff zeroes the corner.
+		const F a  = half - x0 * x0 - y0 * y0;
+		const F a0 = V::Max(a, zero);
+		const F n0 = (a0 * a0) * (a0 * a0) * GradCoord<V>(seed, i, j, x0, y0);
+
+		const F c  = V::Max(V::Set(cSlope) * t + (V::Set(cBase) + a), zero);
+		const F x2 = x0 + V::Set(2 * G2 - 1);
+		const F y2 = y0 + V::Set(2 * G2 - 1);
+		const F n2 = (c * c) * (c * c) * GradCoord<V>(seed, i + V::SetI(c_PrimeX), j + V::SetI(c_PrimeY), x2, y2);
+
+		const M upper = V::Greater(y0, x0);
+
+		const F x1 = x0 + V::Select(upper, V::Set(G2), V::Set(G2 - 1));
+		const F y1 = y0 + V::Select(upper, V::Set(G2 - 1), V::Set(G2));
+		const I i1 = i  + V::SelectI(upper, V::SetI(0), V::SetI(c_PrimeX));
+		const I j1 = j  + V::SelectI(upper, V::SetI(c_PrimeY), V::SetI(0));
+
+		const F b  = V::Max(half - x1 * x1 - y1 * y1, zero);
+		const F n1 = (b * b) * (b * b) * GradCoord<V>(seed, i1, j1, x1, y1);
+
+		return (n0 + n1 + n2) * V::Set(c_SimplexScale);
+	}
+
+	template<typename V, NoiseType Type>
+	inline typename V::F Single(typename V::I seed, typename V::F x, typename V::F y) {
+		if constexpr (Type == NoiseType::Perlin)
+			return SinglePerlin<V>(seed, x, y);
+		else
+			return SingleSimplex<V>(seed, x, y);
+	}
+
+	template<typename V>
+	inline typename V::F PingPong(typename V::F t) {
+		t = t - V::Trunc(t * V::Set(0.5f)) * V::Set(2.0f);
+		return V::Select(V::Less(t, V::Set(1.0f)), t, V::Set(2.0f) - t);
+	}
+
+	// seed replaces params.Settings.Seed, composed graphs offset it per node.
+	template<typename V, NoiseType Type, FractalType Fractal>
+	inline typename V::F Sample(const NoiseKernelParams& params, const int32_t seed, typename V::F x, typename V::F y) {
+		using F = typename V::F;
+
+		const NoiseSettings& settings = params.Settings;
+
+		x = x * V::Set(settings.Frequency);
+		y = y * V::Set(settings.Frequency);
+
+		if constexpr (Type == NoiseType::OpenSimplex2) {
+			const F t = (x + y) * V::Set(c_SkewF2);
+			x = x + t;
+			y = y + t;
+		}
+
+		if constexpr (Fractal == FractalType::None) {
+			return Single<V, Type>(V::SetI(seed), x, y);
+		}
+		else {
+			const F one        = V::Set(1.0f);
+			const F two        = V::Set(2.0f);
+			const F half       = V::Set(0.5f);
+			const F weighted   = V::Set(settings.WeightedStrength);
+			const F lacunarity = V::Set(settings.Lacunarity);
+			const F gain       = V::Set(settings.Gain);
+
+			F sum = V::Set(0.0f);
+			F amp = V::Set(params.FractalBounding);
+
+			for (int octave = 0; octave < settings.Octaves; ++octave) {
+				const F noise = Single<V, Type>(V::SetI(seed + octave), x, y);
+
+				if constexpr (Fractal == FractalType::FBm) {
+					sum = sum + noise * amp;
+					amp = amp * Lerp<V>(one, V::Min(noise + one, two) * half, weighted);
+				}
+				else if constexpr (Fractal == FractalType::Ridged) {
+					const F ridge = V::Abs(noise);
+					sum = sum + (ridge * V::Set(-2.0f) + one) * amp;
+					amp = amp * Lerp<V>(one, one - ridge, weighted);
+				}
+				else {
+					const F pingPong = PingPong<V>((noise + one) * V::Set(settings.PingPongStrength));
+					sum = sum + (pingPong - half) * two * amp;
+					amp = amp * Lerp<V>(one, pingPong, weighted);
+				}
+
+				x   = x * lacunarity;
+				y   = y * lacunarity;
+				amp = amp * gain;
+			}
+
+			return sum;
+		}
+	}
+
+	// Runs sample(x, z) over the grid, V::Width samples along z at a time.
+	template<typename V, typename Sampler>
+	inline void FillGridWith(const NoiseGrid2D& grid, Sampler sample) {
+		using F = typename V::F;
+
+		constexpr size_t width = V::Width;
+
+		const F step    = V::Set(grid.Step);
+		const F originZ = V::Set(grid.OriginZ);
+
+		for (size_t x = 0; x < grid.Width; ++x) {
+			const F sampleX = V::Set(grid.OriginX + static_cast<float>(x) * grid.Step);
+			float*  row     = grid.Out + x * grid.Depth;
+
+			for (size_t z = 0; z < grid.Depth; z += width) {
+				const F sampleZ = originZ + (V::Set(static_cast<float>(z)) + V::Lanes()) * step;
+				const F value   = sample(sampleX, sampleZ);
+
+				if (z + width <= grid.Depth) {
+					V::Store(row + z, value);
+				}
+				else {
+					alignas(64) float tail[width];
+					V::Store(tail, value);
+
+					for (size_t lane = 0; z + lane < grid.Depth; ++lane)
+						row[z + lane] = tail[lane];
+				}
+			}
+		}
+	}
+
+	template<typename V, NoiseType Type, FractalType Fractal>
+	void FillGrid(const NoiseKernelParams& params, const NoiseGrid2D& grid) {
+		using F = typename V::F;
+
+		FillGridWith<V>(grid, [&params](const F x, const F z) {
+			return Sample<V, Type, Fractal>(params, params.Settings.Seed, x, z);
+		});
+	}
+
+	template<typename V, NoiseType Type>
+	void FillGridForFractal(const NoiseKernelParams& params, const NoiseGrid2D& grid) {
+		switch (params.Settings.Fractal) {
+			case FractalType::None:     FillGrid<V, Type, FractalType::None    >(params, grid); break;
+			case FractalType::FBm:      FillGrid<V, Type, FractalType::FBm     >(params, grid); break;
+			case FractalType::Ridged:   FillGrid<V, Type, FractalType::Ridged  >(params, grid); break;
+			case FractalType::PingPong: FillGrid<V, Type, FractalType::PingPong>(params, grid); break;
+		}
+	}
+
+	template<typename V>
+	void FillGridFor(const NoiseKernelParams& params, const NoiseGrid2D& grid) {
+		switch (params.Settings.Type) {
+			case NoiseType::Perlin:       FillGridForFractal<V, NoiseType::Perlin      >(params, grid); break;
+			case NoiseType::OpenSimplex2: FillGridForFractal<V, NoiseType::OpenSimplex2>(params, grid); break;
+		}
+	}
+
+}
@@ -0,0 +1,87 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+// Compiled with AVX2 enabled, only called after BatchedNoise checked the CPU supports it.
+
+
+#include "NoiseKernels.h"
+#include "TerrainNoiseGraphs.h"
+
+#if defined(MCT_NOISE_X86)
+
+#include <immintrin.h>
+
+
+namespace Mct {
+
+	namespace {
+
+		struct Avx2 {
+			struct F {
+				__m256 v;
+
+				friend F operator+(F a, F b) { return { _mm256_add_ps(a.v, b.v) }; }
+				friend F operator-(F a, F b) { return { _mm256_sub_ps(a.v, b.v) }; }
+				friend F operator*(F a, F b) { return { _mm256_mul_ps(a.v, b.v) }; }
+			};
+
+			struct I {
+				__m256i v;
+
+				friend I operator+(I a, I b) { return { _mm256_add_epi32(a.v, b.v) }; }
+				friend I operator*(I a, I b) { return { _mm256_mullo_epi32(a.v, b.v) }; }
+				friend I operator^(I a, I b) { return { _mm256_xor_si256(a.v, b.v) }; }
+				friend I operator&(I a, I b) { return { _mm256_and_si256(a.v, b.v) }; }
+			};
+
+			struct M {
+				__m256 v;
+			};
+
+			static constexpr size_t Width = 8;
+
+			static F Set(float value)    { return { _mm256_set1_ps(value) }; }
+			static I SetI(int32_t value) { return { _mm256_set1_epi32(value) }; }
+			static F Lanes()             { return { _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f) }; }
+
+			static F Floor(F a)          { return { _mm256_floor_ps(a.v) }; }
+			static F Trunc(F a)          { return { _mm256_round_ps(a.v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC) }; }
+			static F Abs(F a)            { return { _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.v) }; }
+			static F Min(F a, F b)       { return { _mm256_min_ps(a.v, b.v) }; }
+			static F Max(F a, F b)       { return { _mm256_max_ps(a.v, b.v) }; }
+			static I ToInt(F a)          { return { _mm256_cvttps_epi32(a.v) }; }
+			static I Sra15(I a)          { return { _mm256_srai_epi32(a.v, 15) }; }
+
+			static M Greater(F a, F b)   { return { _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ) }; }
+			static M Less(F a, F b)      { return { _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ) }; }
+
+			static F Select(M mask, F a, F b) { return { _mm256_blendv_ps(b.v, a.v, mask.v) }; }
+
+			static I SelectI(M mask, I a, I b) {
+				return { _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(b.v), _mm256_castsi256_ps(a.v), mask.v)) };
+			}
+
+			static void LoadGradients(I index, F& xg, F& yg) {
+				const float* gradients = NoiseKernels::c_Gradients2D;
+
+				xg = { _mm256_i32gather_ps(gradients,     index.v, 4) };
+				yg = { _mm256_i32gather_ps(gradients + 1, index.v, 4) };
+			}
+
+			static void Store(float* out, F a) { _mm256_storeu_ps(out, a.v); }
+		};
+
+	}
+
+	void FillNoiseGridAvx2(const NoiseKernelParams& params, const NoiseGrid2D& grid) {
+		NoiseKernels::FillGridFor<Avx2>(params, grid);
+	}
+
+	NoiseGraphKernel_T GetNoiseGraphKernelAvx2(const size_t graphIndex) noexcept {
+		return NoiseKernels::GetGraphKernel<Avx2>(TerrainNoiseGraphs{}, graphIndex);
+	}
+
+}
+
+#endif
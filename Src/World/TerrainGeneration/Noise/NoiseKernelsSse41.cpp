@@ -0,0 +1,91 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+// Compiled with SSE4.1 enabled, only called after BatchedNoise checked the CPU supports it.
+
+
+#include "NoiseKernels.h"
+#include "TerrainNoiseGraphs.h"
+
+#if defined(MCT_NOISE_X86)
+
+#include <immintrin.h>
+
+
+namespace Mct {
+
+	namespace {
+
+		struct Sse41 {
+			struct F {
+				__m128 v;
+
+				friend F operator+(F a, F b) { return { _mm_add_ps(a.v, b.v) }; }
+				friend F operator-(F a, F b) { return { _mm_sub_ps(a.v, b.v) }; }
+				friend F operator*(F a, F b) { return { _mm_mul_ps(a.v, b.v) }; }
+			};
+
+			struct I {
+				__m128i v;
+
+				friend I operator+(I a, I b) { return { _mm_add_epi32(a.v, b.v) }; }
+				friend I operator*(I a, I b) { return { _mm_mullo_epi32(a.v, b.v) }; }
+				friend I operator^(I a, I b) { return { _mm_xor_si128(a.v, b.v) }; }
+				friend I operator&(I a, I b) { return { _mm_and_si128(a.v, b.v) }; }
+			};
+
+			struct M {
+				__m128 v;
+			};
+
+			static constexpr size_t Width = 4;
+
+			static F Set(float value)    { return { _mm_set1_ps(value) }; }
+			static I SetI(int32_t value) { return { _mm_set1_epi32(value) }; }
+			static F Lanes()             { return { _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f) }; }
+
+			static F Floor(F a)          { return { _mm_floor_ps(a.v) }; }
+			static F Trunc(F a)          { return { _mm_round_ps(a.v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC) }; }
+			static F Abs(F a)            { return { _mm_andnot_ps(_mm_set1_ps(-0.0f), a.v) }; }
+			static F Min(F a, F b)       { return { _mm_min_ps(a.v, b.v) }; }
+			static F Max(F a, F b)       { return { _mm_max_ps(a.v, b.v) }; }
+			static I ToInt(F a)          { return { _mm_cvttps_epi32(a.v) }; }
+			static I Sra15(I a)          { return { _mm_srai_epi32(a.v, 15) }; }
+
+			static M Greater(F a, F b)   { return { _mm_cmpgt_ps(a.v, b.v) }; }
+			static M Less(F a, F b)      { return { _mm_cmplt_ps(a.v, b.v) }; }
+
+			static F Select(M mask, F a, F b) { return { _mm_blendv_ps(b.v, a.v, mask.v) }; }
+
+			static I SelectI(M mask, I a, I b) {
+				return { _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(b.v), _mm_castsi128_ps(a.v), mask.v)) };
+			}
+
+			// No gather before AVX2, four scalar loads per component.
+			static void LoadGradients(I index, F& xg, F& yg) {
+				alignas(16) int32_t lanes[4];
+				_mm_store_si128(reinterpret_cast<__m128i*>(lanes), index.v);
+
+				const float* gradients = NoiseKernels::c_Gradients2D;
+
+				xg = { _mm_setr_ps(gradients[lanes[0]],     gradients[lanes[1]],     gradients[lanes[2]],     gradients[lanes[3]])     };
+				yg = { _mm_setr_ps(gradients[lanes[0] | 1], gradients[lanes[1] | 1], gradients[lanes[2] | 1], gradients[lanes[3] | 1]) };
+			}
+
+			static void Store(float* out, F a) { _mm_storeu_ps(out, a.v); }
+		};
+
+	}
+
+	void FillNoiseGridSse41(const NoiseKernelParams& params, const NoiseGrid2D& grid) {
+		NoiseKernels::FillGridFor<Sse41>(params, grid);
+	}
+
+	NoiseGraphKernel_T GetNoiseGraphKernelSse41(const size_t graphIndex) noexcept {
+		return NoiseKernels::GetGraphKernel<Sse41>(TerrainNoiseGraphs{}, graphIndex);
+	}
+
+}
+
+#endif
@@ -0,0 +1,39 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include <cstdint>
+
+
+namespace Mct {
+
+	enum class NoiseType : uint8_t {
+		Perlin,
+		OpenSimplex2
+	};
+
+	enum class FractalType : uint8_t {
+		None,
+		FBm,
+		Ridged,
+		PingPong
+	};
+
+	// Mirrors the FastNoiseLite settings the terrain uses, defaults included, so a generator can
+	// move between the two and get the same noise (within float tolerance).
+	struct NoiseSettings {
+		int         Seed             = 1337;
+		NoiseType   Type             = NoiseType::OpenSimplex2;
+		FractalType Fractal          = FractalType::None;
+		int         Octaves          = 3;
+		float       Frequency        = 0.01f;
+		float       Lacunarity       = 2.0f;
+		float       Gain             = 0.5f;
+		float       WeightedStrength = 0.0f;
+		float       PingPongStrength = 2.0f;
+	};
+
+}
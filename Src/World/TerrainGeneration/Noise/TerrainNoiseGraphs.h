@@ -0,0 +1,95 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+#pragma once
+
+
+#include "NoiseGraph.h"
+
+
+// The seeds below are offsets from the world seed.
+
+
+namespace Mct::NoiseGraph {
+
+	// SimpleTerrainGen, a single ping pong noise mapped onto heights 64 to 214.
+	inline constexpr NoiseSettings c_SimpleHeightNoise{
+		.Seed      = 0,
+		.Type      = NoiseType::Perlin,
+		.Fractal   = FractalType::PingPong,
+		.Octaves   = 8,
+		.Frequency = 0.001f
+	};
+
+	using SimpleTerrainHeight = Add<
+		Constant<64.0f>,
+		Trunc<Remap<Noise<c_SimpleHeightNoise>, -1.0f, 1.0f, 0.0f, 150.0f>>
+	>;
+
+	// WarpedTerrainGen, low plains and ridged hills blended by a continent noise, all of it domain
+	// warped so the coasts and ridges bend instead of following the noise lattice.
+	inline constexpr NoiseSettings c_WarpedContinentNoise{
+		.Seed      = 1,
+		.Type      = NoiseType::OpenSimplex2,
+		.Fractal   = FractalType::FBm,
+		.Octaves   = 3,
+		.Frequency = 0.0008f
+	};
+
+	inline constexpr NoiseSettings c_WarpedPlainsNoise{
+		.Seed      = 2,
+		.Type      = NoiseType::OpenSimplex2,
+		.Fractal   = FractalType::FBm,
+		.Octaves   = 4,
+		.Frequency = 0.004f
+	};
+
+	inline constexpr NoiseSettings c_WarpedHillsNoise{
+		.Seed      = 3,
+		.Type      = NoiseType::Perlin,
+		.Fractal   = FractalType::Ridged,
+		.Octaves   = 5,
+		.Frequency = 0.0025f
+	};
+
+	inline constexpr NoiseSettings c_WarpedOffsetXNoise{
+		.Seed      = 4,
+		.Type      = NoiseType::OpenSimplex2,
+		.Fractal   = FractalType::FBm,
+		.Octaves   = 2,
+		.Frequency = 0.003f
+	};
+
+	inline constexpr NoiseSettings c_WarpedOffsetZNoise{
+		.Seed      = 5,
+		.Type      = NoiseType::OpenSimplex2,
+		.Fractal   = FractalType::FBm,
+		.Octaves   = 2,
+		.Frequency = 0.003f
+	};
+
+	using WarpedTerrainHeight = Floor<DomainWarp<
+		Blend<
+			Noise<c_WarpedContinentNoise>, -0.1f, 0.3f,
+			Remap<Noise<c_WarpedPlainsNoise>, -1.0f, 1.0f, 62.0f,  78.0f>,
+			Remap<Noise<c_WarpedHillsNoise>,  -1.0f, 1.0f, 70.0f, 170.0f>
+		>,
+		Noise<c_WarpedOffsetXNoise>,
+		Noise<c_WarpedOffsetZNoise>,
+		40.0f
+	>>;
+
+}
+
+
+namespace Mct {
+
+	// Every graph a generator samples through FusedNoise, each SIMD translation unit compiles a
+	// kernel for all of them.
+	using TerrainNoiseGraphs = NoiseGraphList<
+		NoiseGraph::SimpleTerrainHeight,
+		NoiseGraph::WarpedTerrainHeight
+	>;
+
+}
@@ -11,7 +11,8 @@
 namespace Mct {
 
 	void SuperFlatTerrainGen::GenerateFor(Chunk& chunk) noexcept {
-        ChunkSpan<Block> blocks = chunk.GetBlocksForWrite();
+        ChunkSpan<Block> blocks     = chunk.GetBlocksForWrite();
+        ChunkHeightmaps& heightmaps = chunk.GetHeightmapsForWrite();
 
         constexpr size_t BEDROCK_Y = 0;
         constexpr size_t GRASS_Y   = 4;     // 1..3 dirt, 4 grass
@@ -32,6 +33,9 @@ namespace Mct {
                 // Air above
                 for (size_t y = GRASS_Y + 1; y < blocks.SizeY(); ++y)
                     blocks(x, y, z) = Block{ CoreBlocks::Air };
+
+                for (size_t type = 0; type < static_cast<size_t>(HeightmapType::COUNT); ++type)
+                    heightmaps.Set(static_cast<HeightmapType>(type), x, z, static_cast<uint16_t>(GRASS_Y + 1));
             }
         }
 	}
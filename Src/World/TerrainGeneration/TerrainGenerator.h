@@ -8,10 +8,15 @@
 
 
 #include "World/WorldSettings.h"
+#include "World/Chunk/ChunkCoord.h"
 #include "SuperFlatTerrainGen.h"
-#include "SimpleTerrainGen.h"
+#include "HeightfieldTerrainGen.h"
+#include "BiomeTerrainGen.h"
+#include "DensityTerrainGen.h"
 
 #include <memory>
+#include <span>
+#include <utility>
 #include <variant>
 
 
@@ -23,17 +28,35 @@ namespace Mct {
 		using Generator_T = std::variant<
 			std::monostate,
 			SuperFlatTerrainGen,
-			SimpleTerrainGen
+			SimpleTerrainGen,
+			WarpedTerrainGen,
+			BiomeTerrainGen,
+			DensityTerrainGen
 		>;
 
 	public:
-		template<typename T>
-		static TerrainGenerator Create() {
+		// Chunks per side of a region tile, the unit GenerateRegion is meant for.
+		static constexpr int c_RegionSize = 4;
+
+		template<typename T, typename... Args>
+		static TerrainGenerator Create(Args&&... args) {
 			TerrainGenerator terrainGenerator;
-			terrainGenerator.m_Generator.emplace<T>();
+			terrainGenerator.m_Generator.emplace<T>(std::forward<Args>(args)...);
 			return terrainGenerator;
 		}
 
+		static TerrainGenerator Create(TerrainType type, int32_t seed) {
+			switch (type) {
+				case TerrainType::SuperFlat: return Create<SuperFlatTerrainGen>();
+				case TerrainType::Simple:    return Create<SimpleTerrainGen>(seed);
+				case TerrainType::Warped:    return Create<WarpedTerrainGen>(seed);
+				case TerrainType::Biome:     return Create<BiomeTerrainGen>(seed);
+				case TerrainType::Density:   return Create<DensityTerrainGen>(seed);
+			}
+
+			return TerrainGenerator{};
+		}
+
 		virtual void GenerateFor(Chunk& chunk) {
 			std::visit([&chunk](auto&& activeGenerator) {
 				using T = std::decay_t<decltype(activeGenerator)>;
@@ -44,6 +67,40 @@ namespace Mct {
 			}, m_Generator);
 		}
 
+		// Generators sharing their 2D fields across chunks (BiomeTerrainGen) compute them once for
+		// all the chunks, the others still go chunk by chunk. The chunks should share a region tile.
+		virtual void GenerateRegion(std::span<Chunk* const> chunks) {
+			std::visit([chunks](auto&& activeGenerator) {
+				using T = std::decay_t<decltype(activeGenerator)>;
+
+				if constexpr (requires { activeGenerator.GenerateRegion(chunks); }) {
+					activeGenerator.GenerateRegion(chunks);
+				}
+				else if constexpr (!std::is_same_v<T, std::monostate>) {
+					for (Chunk* const chunk : chunks) {
+						activeGenerator.GenerateFor(*chunk);
+					}
+				}
+			}, m_Generator);
+		}
+
+		// Zeroed for the generators without a climate cache.
+		[[nodiscard]] ClimateCacheStats GetClimateCacheStats() const {
+			return std::visit([](auto&& activeGenerator) {
+				if constexpr (requires { activeGenerator.GetClimateCacheStats(); }) {
+					return activeGenerator.GetClimateCacheStats();
+				}
+				else {
+					return ClimateCacheStats{};
+				}
+			}, m_Generator);
+		}
+
+		// Lowest coord of the region tile holding coord.
+		[[nodiscard]] static constexpr ChunkCoord GetRegionOrigin(const ChunkCoord coord) noexcept {
+			return { .X = FloorDiv(coord.X, c_RegionSize) * c_RegionSize, .Z = FloorDiv(coord.Z, c_RegionSize) * c_RegionSize };
+		}
+
 	private:
 		TerrainGenerator() noexcept = default;
 
@@ -10,13 +10,16 @@
 namespace Mct {
 
 	World::World(const WorldSettings& settings) :
-			m_ChunkManager(TerrainGenerator::Create<SimpleTerrainGen>())
+			m_ChunkManager ( TerrainGenerator::Create(settings.TerrainType, settings.Seed), m_JobSystem         ),
+			m_JobSystem    ( settings.WorkerCount ? settings.WorkerCount : JobSystem::GetDefaultWorkerCount() ),
+			m_Streaming    ( m_ChunkManager                                                                    )
 	{}
 
-	void World::Update(float deltaTime, glm::vec3 playerPos) {
+	void World::Update(float deltaTime, glm::vec3 playerPos, glm::vec3 playerVelocity) {
 		m_GameTime.Update(deltaTime);
-		m_Sky.Update(m_GameTime);
-		m_ChunkManager.Update(playerPos);
+		m_Streaming.SyncMainThread(playerPos, playerVelocity);
+
+		m_JobSystem.GetMetrics().Sample();
 	}
 
 }
@@ -9,8 +9,9 @@
 
 #include "WorldSettings.h"
 #include "ChunkManager.h"
-#include "Sky.h"
+#include "StreamingCoordinator.h"
 #include "WorldTime.h"
+#include "Utils/JobSystem.h"
 
 #include <memory>
 
@@ -21,28 +22,45 @@ namespace Mct {
 	public:
 		World(const WorldSettings& settings);
 
-		void Update(float deltaTime, glm::vec3 playerPos);
+		void Update(float deltaTime, glm::vec3 playerPos, glm::vec3 playerVelocity);
 
+		// Driven by the streaming thread, not safe to use from the main thread.
 		[[nodiscard]] ChunkManager& GetChunkManager() noexcept {
 			return m_ChunkManager;
 		}
 
-		[[nodiscard]] const Sky& GetSky() const noexcept {
-			return m_Sky;
-		}
-
-		[[nodiscard]] glm::vec3 GetSunDirection() const noexcept {
-			return m_Sky.GetSunDirection();
+		// Main thread view of the streaming thread: renderable chunks, statistics and lifecycle tracing.
+		[[nodiscard]] StreamingCoordinator& GetStreaming() noexcept {
+			return m_Streaming;
 		}
 
 		[[nodiscard]] WorldTime& GetGameTime() noexcept {
 			return m_GameTime;
 		}
 
+		[[nodiscard]] JobSystem& GetJobSystem() noexcept {
+			return m_JobSystem;
+		}
+
 	private:
-		Sky          m_Sky;
 		WorldTime    m_GameTime;
 		ChunkManager m_ChunkManager;
+
+		// IMPORTANT
+		// m_JobSystem MUST be declared after m_ChunkManager.
+		//
+		// Members are destroyed in reverse order, so the workers are stopped and joined
+		// before the ChunkManager whose result queues the running jobs write into.
+		// ChunkManager (and its DeferredReclaimer) keep the reference for their whole lifetime,
+		// but it refers to a live JobSystem only between the end of m_JobSystem's construction
+		// and the start of its destruction. Their constructors and destructors must not use it,
+		// only Update and what it calls, which run on m_Streaming's thread within that window.
+
+		JobSystem    m_JobSystem;
+
+		// Destroyed first, the streaming thread is joined before the jobs it submitted are
+		// stopped and before the ChunkManager it drives.
+		StreamingCoordinator m_Streaming;
 	};
 
 }
@@ -7,15 +7,30 @@
 #pragma once
 
 
+#include <cstddef>
+#include <cstdint>
+
+
 namespace Mct {
 
     enum class TerrainType {
-        SuperFlat
+        SuperFlat,
+        Simple,         // Single heightmap noise.
+        Warped,         // Domain warped plains and hills, composed from noise graph nodes.
+        Biome,          // Climate driven biomes from BiomeData.yaml.
+        Density         // 3D density with overhangs and caves.
     };
 
 
     struct WorldSettings {
-        TerrainType TerrainType;
+        Mct::TerrainType TerrainType;
+
+        // Every noise and hash of the generators derives from it, the same seed and TerrainType give
+        // the same blocks whatever the worker count, SIMD level or generation order.
+        int32_t Seed = 4346;
+
+        // Workers of the world's JobSystem, 0 picks JobSystem::GetDefaultWorkerCount().
+        size_t WorkerCount = 0;
     };
 
 }
@@ -0,0 +1,879 @@
+// SPDX - License - Identifier: MIT
+// Copyright(c) 2025 Jayantkumar56
+
+
+// Headless bulk world pregeneration, links only the world library (no window, GL context or ImGui).
+//
+// Generates (and optionally meshes) a width x depth region of chunks centered on the origin, through
+// the same streaming pipeline as the game. The region is walked in tiles the size of the streamed
+// range, each tile is requested at once with a ChunkPregenerator so every worker stays busy. CPU
+// meshes are dropped where the game would upload them.
+//
+// Reports throughput, per stage latencies from the chunk timelines and peak memory. With --out the
+// blocks of every chunk are written to a file:
+//     "QVRG", uint32 version, then per chunk: int32 x, int32 z, uint32 runCount,
+//     runCount x (uint16 blockId, uint16 length) run length encoded in BlockStorage order.
+// With --hash it prints a hash of the blocks of every chunk, independent of the generation order.
+//
+// Golden hashes: --record-golden generates the same c_GoldenSize x c_GoldenSize chunks with every
+// terrain type and writes their hashes to a file, --check-golden regenerates them with the seed and
+// size in that file and exits with 1 when any differs. Record on a known good build, then any change
+// altering the world output (a faster kernel, a new tiling, more workers) shows up as a mismatch.
+// --check-golden also regenerates the golden region at every SIMD level the CPU supports, and checks
+// the bare terrain (no decoration) generated chunk by chunk and by region tile against the scalar
+// region tiles, so a kernel or a generator whose output depends on either shows up as well.
+// Tools/WorldPregenGolden.txt holds the golden hashes of the default seed, the WorldPregenGolden
+// CTest checks them. The world is compiled with precise float math, so the hashes hold across
+// build types, compilers may still round differently.
+//
+// --check-requests drives ChunkManager::Request coroutines through a superflat world: requests
+// resolving on a worker and on the main thread, a request whose chunk is unloaded before reaching
+// its stage, and requests still pending when the World is destroyed, some as continuations queued
+// behind busy workers. Every coroutine frame has to be gone with the World, exits with 1 otherwise.
+// The WorldPregenRequests CTest runs it.
+//
+// Usage: WorldPregen [width] [depth] [--mesh] [--workers N] [--terrain flat|simple|warped|biome|density]
+//                    [--seed N] [--out path] [--hash] [--max-simd scalar|sse41|avx2]
+//        WorldPregen --record-golden path | --check-golden path [--workers N] [--seed N] [--max-simd ...]
+//        WorldPregen --check-requests [--workers N]
+//        Defaults to 64 x 64 chunks, generation only, JobSystem::GetDefaultWorkerCount() workers,
+//        biome terrain, WorldSettings' seed and the widest noise kernels the CPU supports.
+//        Run from the repository root so Assets/ is found.
+
+
+#include "World/World.h"
+#include "World/ChunkPregenerator.h"
+#include "World/Chunk/CompressedBlocks.h"
+#include "World/Block/BlockDataManager.h"
+#include "World/Biome/BiomeDataManager.h"
+#include "World/TerrainGeneration/TerrainGenerator.h"
+#include "World/TerrainGeneration/Noise/BatchedNoise.h"
+#include "Utils/Coroutine.h"
+#include "Utils/Logger.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+    #define NOMINMAX
+    #include <windows.h>
+    #include <psapi.h>
+#else
+    #include <sys/resource.h>
+#endif
+
+
+namespace {
+
+    using Clock_T = std::chrono::steady_clock;
+
+    struct Options {
+        int         Width       = 64;
+        int         Depth       = 64;
+        bool        Mesh        = false;
+        size_t      WorkerCount = 0;
+        int32_t     Seed        = Mct::WorldSettings{}.Seed;
+        bool        Hash        = false;
+        std::string OutPath;
+        std::string RecordGoldenPath;
+        std::string CheckGoldenPath;
+        bool        CheckRequests = false;
+
+        Mct::TerrainType               Terrain = Mct::TerrainType::Biome;
+        std::optional<Mct::SimdLevel> MaxSimd;
+    };
+
+    struct TerrainName {
+        const char*      Name;
+        Mct::TerrainType Type;
+    };
+
+    constexpr TerrainName c_TerrainNames[] = {
+        { "flat",    Mct::TerrainType::SuperFlat },
+        { "simple",  Mct::TerrainType::Simple    },
+        { "warped",  Mct::TerrainType::Warped    },
+        { "biome",   Mct::TerrainType::Biome     },
+        { "density", Mct::TerrainType::Density   }
+    };
+
+    struct SimdLevelName {
+        const char*    Name;
+        Mct::SimdLevel Level;
+    };
+
+    constexpr SimdLevelName c_SimdLevelNames[] = {
+        { "scalar", Mct::SimdLevel::Scalar },
+        { "sse41",  Mct::SimdLevel::Sse41  },
+        { "avx2",   Mct::SimdLevel::Avx2   }
+    };
+
+    // Chunks per side of the golden hash region, centered on the origin like any other run.
+    constexpr int c_GoldenSize = 16;
+
+    // FNV-1a, the same on every platform and run unlike std::hash.
+    constexpr uint64_t c_HashBasis = 14695981039346656037ull;
+
+    template<typename T>
+    uint64_t HashValue(uint64_t hash, const T value) {
+        const auto* bytes = reinterpret_cast<const unsigned char*>(&value);
+
+        for (size_t i = 0; i < sizeof(T); ++i) {
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+        }
+
+        return hash;
+    }
+
+    // Spans between consecutive timeline stamps, in milliseconds.
+    enum StageSpan : size_t {
+        QueueWait,      // Requested -> GenerationStart
+        Generation,     // GenerationStart -> GenerationEnd, per chunk of the terrain job
+        Decoration,     // GenerationEnd -> Decorated, mostly waiting for the neighbors
+        MeshWait,       // Decorated -> MeshStart
+        Meshing,        // MeshStart -> MeshEnd
+        SpanCount
+    };
+
+    constexpr const char* c_SpanNames[SpanCount] = { "queue wait", "generation", "decoration", "mesh wait", "meshing" };
+
+    // Fed from the workers as chunks reach their stage.
+    class ChunkSink {
+    public:
+        bool Open(const std::string& path) {
+            m_File.open(path, std::ios::binary | std::ios::trunc);
+
+            if (!m_File)
+                return false;
+
+            const uint32_t version = 1;
+            m_File.write("QVRG", 4);
+            m_File.write(reinterpret_cast<const char*>(&version), sizeof(version));
+
+            return true;
+        }
+
+        void OnChunk(const Mct::Chunk& chunk) {
+            const Mct::ChunkTimeline& timeline = chunk.GetTimeline();
+
+            std::array<float, SpanCount> spans;
+            spans[QueueWait]  = GetSpanMs(timeline, Mct::ChunkLifecycleStage::Requested,       Mct::ChunkLifecycleStage::GenerationStart);
+            spans[Generation] = GetSpanMs(timeline, Mct::ChunkLifecycleStage::GenerationStart, Mct::ChunkLifecycleStage::GenerationEnd) /
+                                static_cast<float>(timeline.GenerationBatch);
+            spans[Decoration] = GetSpanMs(timeline, Mct::ChunkLifecycleStage::GenerationEnd,   Mct::ChunkLifecycleStage::Decorated);
+            spans[MeshWait]   = GetSpanMs(timeline, Mct::ChunkLifecycleStage::Decorated,       Mct::ChunkLifecycleStage::MeshStart);
+            spans[Meshing]    = GetSpanMs(timeline, Mct::ChunkLifecycleStage::MeshStart,       Mct::ChunkLifecycleStage::MeshEnd);
+
+            // Compressed and hashed outside the lock, it is the expensive part.
+            Mct::CompressedBlocks blocks;
+            if (m_File.is_open() || m_HashChunks) {
+                blocks = Mct::CompressedBlocks::Compress(chunk.GetBlockStorage());
+            }
+
+            const uint64_t blocksHash = m_HashChunks ? HashBlocks(blocks) : 0;
+
+            std::lock_guard<std::mutex> lock(m_Mutex);
+
+            for (size_t span = 0; span < SpanCount; ++span) {
+                if (spans[span] >= 0.0f) {
+                    m_SpanSamples[span].push_back(spans[span]);
+                }
+            }
+
+            if (m_File.is_open()) {
+                WriteChunk(chunk.GetCoord(), blocks);
+            }
+
+            // A chunk reported twice (reloaded from the cache) has the same blocks both times.
+            if (m_HashChunks) {
+                m_ChunkHashes[{ chunk.GetCoord().X, chunk.GetCoord().Z }] = blocksHash;
+            }
+        }
+
+        void EnableHashing() noexcept { m_HashChunks = true; }
+
+        // Over the chunk hashes in coord order, so the generation order doesn't matter.
+        [[nodiscard]] uint64_t GetWorldHash() const {
+            uint64_t hash = c_HashBasis;
+
+            for (const auto& [coord, blocksHash] : m_ChunkHashes) {
+                hash = HashValue(hash, coord.first);
+                hash = HashValue(hash, coord.second);
+                hash = HashValue(hash, blocksHash);
+            }
+
+            return hash;
+        }
+
+        [[nodiscard]] size_t GetHashedChunkCount() const noexcept { return m_ChunkHashes.size(); }
+
+        // Once the pool is idle.
+        void PrintSpans() {
+            std::printf("%-12s %10s %10s %10s %10s\n", "stage", "chunks", "p50 ms", "p95 ms", "max ms");
+
+            for (size_t span = 0; span < SpanCount; ++span) {
+                std::vector<float>& samples = m_SpanSamples[span];
+
+                if (samples.empty())
+                    continue;
+
+                std::sort(samples.begin(), samples.end());
+
+                auto percentile = [&samples](float p) {
+                    return samples[static_cast<size_t>(p * static_cast<float>(samples.size() - 1))];
+                };
+
+                std::printf("%-12s %10zu %10.2f %10.2f %10.2f\n", c_SpanNames[span], samples.size(),
+                            percentile(0.5f), percentile(0.95f), samples.back());
+            }
+        }
+
+        [[nodiscard]] uint64_t GetBytesWritten() const noexcept { return m_BytesWritten; }
+
+    private:
+        // Negative when either stamp is missing, chunks reinstated from the cache have no timeline.
+        static float GetSpanMs(const Mct::ChunkTimeline& timeline, Mct::ChunkLifecycleStage from, Mct::ChunkLifecycleStage to) {
+            if (!timeline.Has(from) || !timeline.Has(to))
+                return -1.0f;
+
+            return std::chrono::duration<float, std::milli>(timeline.Get(to) - timeline.Get(from)).count();
+        }
+
+        static uint64_t HashBlocks(const Mct::CompressedBlocks& blocks) {
+            uint64_t hash = c_HashBasis;
+
+            for (const Mct::CompressedBlocks::Run& run : blocks.GetRuns()) {
+                hash = HashValue(hash, static_cast<uint16_t>(run.Type));
+                hash = HashValue(hash, static_cast<uint16_t>(run.Length));
+            }
+
+            return hash;
+        }
+
+        void WriteChunk(const Mct::ChunkCoord coord, const Mct::CompressedBlocks& blocks) {
+            const auto runs = blocks.GetRuns();
+
+            const int32_t  x        = coord.X;
+            const int32_t  z        = coord.Z;
+            const uint32_t runCount = static_cast<uint32_t>(runs.size());
+
+            m_File.write(reinterpret_cast<const char*>(&x),        sizeof(x));
+            m_File.write(reinterpret_cast<const char*>(&z),        sizeof(z));
+            m_File.write(reinterpret_cast<const char*>(&runCount), sizeof(runCount));
+
+            for (const Mct::CompressedBlocks::Run& run : runs) {
+                const uint16_t type = run.Type;
+                m_File.write(reinterpret_cast<const char*>(&type),       sizeof(type));
+                m_File.write(reinterpret_cast<const char*>(&run.Length), sizeof(run.Length));
+            }
+
+            m_BytesWritten += 3 * sizeof(uint32_t) + runs.size() * 2 * sizeof(uint16_t);
+        }
+
+    private:
+        std::mutex                                      m_Mutex;
+        std::ofstream                                   m_File;
+        uint64_t                                        m_BytesWritten = 0;
+        std::array<std::vector<float>, SpanCount>       m_SpanSamples;
+
+        bool                                            m_HashChunks = false;
+        std::map<std::pair<int32_t, int32_t>, uint64_t> m_ChunkHashes;
+    };
+
+    size_t GetPeakResidentBytes() {
+#if defined(_WIN32)
+        PROCESS_MEMORY_COUNTERS counters{};
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+            return counters.PeakWorkingSetSize;
+        }
+        return 0;
+#else
+        rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+    #if defined(__APPLE__)
+        return static_cast<size_t>(usage.ru_maxrss);
+    #else
+        return static_cast<size_t>(usage.ru_maxrss) * 1024;
+    #endif
+#endif
+    }
+
+    // Stands in for the renderer: takes the CPU meshes the pipeline is waiting on to be uploaded.
+    uint64_t ConsumeMeshes(const Mct::RenderableSet& renderable) {
+        uint64_t bytes = 0;
+
+        for (const std::shared_ptr<Mct::Chunk>& chunk : renderable.Chunks) {
+            if (!chunk->HaveDirtyMesh())
+                continue;
+
+            std::unique_ptr<Mct::ChunkMesh> mesh = chunk->GetMeshForUpload();
+
+            for (const Mct::SubchunkMesh& subchunkMesh : mesh->SubchunkMesh) {
+                for (const Mct::Mesh* part : { static_cast<const Mct::Mesh*>(&subchunkMesh.SolidMesh),
+                                               static_cast<const Mct::Mesh*>(&subchunkMesh.WaterMesh) })
+                {
+                    const Mct::MeshUploadDesc& desc = part->GetDesc();
+                    const size_t indexSize = desc.IndexType == Mct::IndexType::UInt16 ? 2
+                                           : desc.IndexType == Mct::IndexType::UInt32 ? 4 : 0;
+
+                    bytes += desc.VertexCount * desc.VertexLayout.GetStride() + desc.IndexCount * indexSize;
+                }
+            }
+
+            // An empty GPU mesh, there is nothing to upload to.
+            chunk->SetGpuMesh(std::make_unique<Mct::ChunkGpuMesh>());
+        }
+
+        return bytes;
+    }
+
+    bool ParseTerrain(const char* name, Mct::TerrainType& outTerrain) {
+        for (const TerrainName& terrain : c_TerrainNames) {
+            if (std::strcmp(name, terrain.Name) == 0) {
+                outTerrain = terrain.Type;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool ParseSimdLevel(const char* name, std::optional<Mct::SimdLevel>& outLevel) {
+        for (const SimdLevelName& level : c_SimdLevelNames) {
+            if (std::strcmp(name, level.Name) == 0) {
+                outLevel = level.Level;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool ParseOptions(int argc, char** argv, Options& options) {
+        int positional = 0;
+
+        for (int i = 1; i < argc; ++i) {
+            if (std::strcmp(argv[i], "--mesh") == 0) {
+                options.Mesh = true;
+            }
+            else if (std::strcmp(argv[i], "--workers") == 0 && i + 1 < argc) {
+                options.WorkerCount = static_cast<size_t>(std::max(1, std::atoi(argv[++i])));
+            }
+            else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+                options.Seed = static_cast<int32_t>(std::strtol(argv[++i], nullptr, 10));
+            }
+            else if (std::strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+                options.OutPath = argv[++i];
+            }
+            else if (std::strcmp(argv[i], "--hash") == 0) {
+                options.Hash = true;
+            }
+            else if (std::strcmp(argv[i], "--record-golden") == 0 && i + 1 < argc) {
+                options.RecordGoldenPath = argv[++i];
+            }
+            else if (std::strcmp(argv[i], "--check-golden") == 0 && i + 1 < argc) {
+                options.CheckGoldenPath = argv[++i];
+            }
+            else if (std::strcmp(argv[i], "--check-requests") == 0) {
+                options.CheckRequests = true;
+            }
+            else if (std::strcmp(argv[i], "--terrain") == 0 && i + 1 < argc && ParseTerrain(argv[i + 1], options.Terrain)) {
+                ++i;
+            }
+            else if (std::strcmp(argv[i], "--max-simd") == 0 && i + 1 < argc && ParseSimdLevel(argv[i + 1], options.MaxSimd)) {
+                ++i;
+            }
+            else if (argv[i][0] != '-' && positional < 2) {
+                (positional++ == 0 ? options.Width : options.Depth) = std::max(1, std::atoi(argv[i]));
+            }
+            else {
+                std::fprintf(stderr, "Usage: WorldPregen [width] [depth] [--mesh] [--workers N] [--terrain flat|simple|warped|biome|density]\n"
+                                     "                   [--seed N] [--out path] [--hash] [--max-simd scalar|sse41|avx2]\n"
+                                     "       WorldPregen --record-golden path | --check-golden path [--workers N] [--seed N] [--max-simd ...]\n"
+                                     "       WorldPregen --check-requests [--workers N]\n");
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+
+    // Generates (and meshes) the options' region into sink, printing the throughput report. Every
+    // worker has finished when it returns.
+    void Pregenerate(const Options& options, ChunkSink& sink) {
+        uint64_t meshBytes  = 0;
+        size_t   chunkCount = 0;
+        size_t   unloaded   = 0;
+        double   seconds    = 0.0;
+
+        Mct::World world(Mct::WorldSettings{
+            .TerrainType { options.Terrain     },
+            .Seed        { options.Seed        },
+            .WorkerCount { options.WorkerCount }
+        });
+
+        const size_t workerCount = world.GetJobSystem().GetWorkerCount();
+
+        // Tiles cover the range the pipeline keeps loaded around the player, and only chunks within
+        // the render distance ever get meshed.
+        const int tileSize = 2 * (options.Mesh ? Mct::WorldConst::RenderDistance : Mct::WorldConst::LoadDistance) + 1;
+        const int tilesX   = (options.Width + tileSize - 1) / tileSize;
+        const int tilesZ   = (options.Depth + tileSize - 1) / tileSize;
+
+        const Mct::ChunkCoord regionMin{ -options.Width / 2, -options.Depth / 2 };
+        const Mct::ChunkStage stage = options.Mesh ? Mct::ChunkStage::Meshed : Mct::ChunkStage::Generated;
+
+        std::printf("WorldPregen: %d x %d chunks (%s), %zu workers, %d x %d tiles of %d chunks, %s noise, seed %d\n",
+                    options.Width, options.Depth, options.Mesh ? "generate + mesh" : "generate",
+                    workerCount, tilesX, tilesZ, tileSize, Mct::ToString(Mct::BatchedNoise::GetSupportedSimdLevel()),
+                    options.Seed);
+
+        Mct::ChunkPregenerator pregen;
+        std::vector<Mct::ChunkPregenerator::Target> targets;
+
+        const auto start = Clock_T::now();
+
+        for (int tz = 0; tz < tilesZ; ++tz) {
+            for (int i = 0; i < tilesX; ++i) {
+                // Serpentine, neighboring tiles share their border chunks.
+                const int tx = (tz % 2 == 0) ? i : tilesX - 1 - i;
+
+                const Mct::ChunkCoord tileMin{ regionMin.X + tx * tileSize, regionMin.Z + tz * tileSize };
+                const Mct::ChunkCoord tileMax{
+                    std::min(tileMin.X + tileSize, regionMin.X + options.Width) - 1,
+                    std::min(tileMin.Z + tileSize, regionMin.Z + options.Depth) - 1
+                };
+
+                targets.clear();
+
+                for (int x = tileMin.X; x <= tileMax.X; ++x) {
+                    for (int z = tileMin.Z; z <= tileMax.Z; ++z) {
+                        targets.push_back({ .Coord { x, z }, .Stage { stage } });
+                    }
+                }
+
+                pregen.Start(world.GetChunkManager(), targets, [&sink](const std::shared_ptr<Mct::Chunk>& chunk) {
+                    sink.OnChunk(*chunk);
+                });
+
+                const glm::vec3 playerPos{
+                    static_cast<float>((tileMin.X + tileSize / 2) * static_cast<int>(Mct::WorldConst::ChunkSizeX)) + 8.0f,
+                    100.0f,
+                    static_cast<float>((tileMin.Z + tileSize / 2) * static_cast<int>(Mct::WorldConst::ChunkSizeZ)) + 8.0f
+                };
+
+                auto frameTime = Clock_T::now();
+
+                while (!pregen.GetProgress().IsComplete()) {
+                    const auto now = Clock_T::now();
+                    world.Update(std::chrono::duration<float>(now - frameTime).count(), playerPos, glm::vec3(0.0f));
+                    frameTime = now;
+
+                    meshBytes += ConsumeMeshes(world.GetStreaming().GetRenderableSet());
+
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+
+                const Mct::PregenProgress progress = pregen.GetProgress();
+                chunkCount += progress.Completed - progress.Unloaded;
+                unloaded   += progress.Unloaded;
+
+                std::printf("\r%zu / %d chunks", chunkCount, options.Width * options.Depth);
+                std::fflush(stdout);
+            }
+        }
+
+        seconds = std::chrono::duration<double>(Clock_T::now() - start).count();
+        std::printf("\n");
+
+        const Mct::StreamingStats& stats = world.GetStreaming().GetStats();
+
+        std::printf("%zu chunks in %.2f s, %.1f chunks/s (%zu unloaded before completing)\n",
+                    chunkCount, seconds, static_cast<double>(chunkCount) / seconds, unloaded);
+        std::printf("Time to first mesh: avg %.1f ms, max %.1f ms\n", stats.MeshLatency.AverageMs, stats.MeshLatency.MaxMs);
+
+        if (options.Mesh) {
+            std::printf("CPU meshes: %.1f MiB\n", static_cast<double>(meshBytes) / (1024.0 * 1024.0));
+        }
+
+        std::printf("Chunk cache: %zu chunks, %.1f MiB compressed\n",
+                    stats.Cache.Entries, static_cast<double>(stats.Cache.CompressedBytes) / (1024.0 * 1024.0));
+
+        const Mct::ClimateCacheStats climate = world.GetChunkManager().GetClimateCacheStats();
+
+        if (climate.Hits + climate.Misses > 0) {
+            std::printf("Climate cache: %.1f%% hits (%llu / %llu), %zu / %zu tiles, %.1f KiB, %llu evicted\n",
+                        100.0 * climate.GetHitRate(), static_cast<unsigned long long>(climate.Hits),
+                        static_cast<unsigned long long>(climate.Hits + climate.Misses), climate.Entries, climate.Capacity,
+                        static_cast<double>(climate.Bytes) / 1024.0, static_cast<unsigned long long>(climate.Evictions));
+        }
+    }
+
+    int RunPregen(const Options& options) {
+        ChunkSink sink;
+
+        if (!options.OutPath.empty() && !sink.Open(options.OutPath)) {
+            std::fprintf(stderr, "Failed to open %s for writing\n", options.OutPath.c_str());
+            return 1;
+        }
+
+        if (options.Hash) {
+            sink.EnableHashing();
+        }
+
+        Pregenerate(options, sink);
+        sink.PrintSpans();
+
+        if (!options.OutPath.empty()) {
+            std::printf("Wrote %.1f MiB to %s\n", static_cast<double>(sink.GetBytesWritten()) / (1024.0 * 1024.0), options.OutPath.c_str());
+        }
+
+        if (options.Hash) {
+            std::printf("World hash: %016llx (%zu chunks)\n", static_cast<unsigned long long>(sink.GetWorldHash()), sink.GetHashedChunkCount());
+        }
+
+        return 0;
+    }
+
+    // The world hash of every terrain type over the golden region, in c_TerrainNames order.
+    std::vector<uint64_t> HashTerrains(Options options, const int size) {
+        options.Width = size;
+        options.Depth = size;
+        options.Mesh  = false;
+
+        std::vector<uint64_t> hashes;
+
+        for (const TerrainName& terrain : c_TerrainNames) {
+            options.Terrain = terrain.Type;
+
+            ChunkSink sink;
+            sink.EnableHashing();
+            Pregenerate(options, sink);
+
+            hashes.push_back(sink.GetWorldHash());
+        }
+
+        return hashes;
+    }
+
+    int RecordGolden(const Options& options) {
+        const std::vector<uint64_t> hashes = HashTerrains(options, c_GoldenSize);
+
+        std::ofstream file(options.RecordGoldenPath, std::ios::trunc);
+
+        if (!file) {
+            std::fprintf(stderr, "Failed to open %s for writing\n", options.RecordGoldenPath.c_str());
+            return 1;
+        }
+
+        file << "# WorldPregen golden hashes: seed, chunks per side, then the world hash of each terrain\n";
+        file << "seed " << options.Seed << "\n";
+        file << "size " << c_GoldenSize << "\n";
+
+        for (size_t i = 0; i < hashes.size(); ++i) {
+            char hex[17];
+            std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(hashes[i]));
+            file << c_TerrainNames[i].Name << " " << hex << "\n";
+        }
+
+        std::printf("Recorded %zu golden hashes to %s\n", hashes.size(), options.RecordGoldenPath.c_str());
+        return 0;
+    }
+
+    // The bare terrain of the golden region generated straight through a TerrainGenerator, without
+    // the pipeline or decoration. By region tile like the ChunkManager, or chunk by chunk.
+    uint64_t HashTerrain(const Options& options, const Mct::TerrainType type, const int size, const bool perChunk) {
+        Mct::TerrainGenerator generator = Mct::TerrainGenerator::Create(type, options.Seed);
+
+        const Mct::ChunkCoord regionMin{ -size / 2, -size / 2 };
+
+        std::map<Mct::ChunkCoord, std::vector<std::unique_ptr<Mct::Chunk>>> tiles;
+
+        for (int x = regionMin.X; x < regionMin.X + size; ++x) {
+            for (int z = regionMin.Z; z < regionMin.Z + size; ++z) {
+                const Mct::ChunkCoord coord{ .X = x, .Z = z };
+                tiles[Mct::TerrainGenerator::GetRegionOrigin(coord)].push_back(std::make_unique<Mct::Chunk>(coord));
+            }
+        }
+
+        ChunkSink sink;
+        sink.EnableHashing();
+
+        for (auto& [origin, chunks] : tiles) {
+            std::vector<Mct::Chunk*> region;
+
+            for (const std::unique_ptr<Mct::Chunk>& chunk : chunks) {
+                region.push_back(chunk.get());
+            }
+
+            if (perChunk) {
+                for (Mct::Chunk* chunk : region) {
+                    generator.GenerateFor(*chunk);
+                }
+            }
+            else {
+                generator.GenerateRegion(region);
+            }
+
+            for (const Mct::Chunk* chunk : region) {
+                sink.OnChunk(*chunk);
+            }
+        }
+
+        return sink.GetWorldHash();
+    }
+
+    int CheckGolden(Options options) {
+        std::ifstream file(options.CheckGoldenPath);
+
+        if (!file) {
+            std::fprintf(stderr, "Failed to open %s\n", options.CheckGoldenPath.c_str());
+            return 1;
+        }
+
+        int                                       size = c_GoldenSize;
+        std::map<std::string, unsigned long long> expected;
+
+        for (std::string key, value; file >> key;) {
+            if (key.starts_with("#")) {
+                std::getline(file, value);
+                continue;
+            }
+
+            file >> value;
+
+            if (key == "seed")
+                options.Seed = static_cast<int32_t>(std::strtol(value.c_str(), nullptr, 10));
+            else if (key == "size")
+                size = std::max(1, std::atoi(value.c_str()));
+            else
+                expected[key] = std::strtoull(value.c_str(), nullptr, 16);
+        }
+
+        struct LevelHashes {
+            Mct::SimdLevel        Level;
+            std::vector<uint64_t> Pipeline;
+            std::vector<uint64_t> Region;
+            std::vector<uint64_t> PerChunk;
+        };
+
+        // Every level up to the supported one (as capped by --max-simd), scalar first as the reference.
+        const Mct::SimdLevel  maxLevel = Mct::BatchedNoise::GetSupportedSimdLevel();
+        std::vector<LevelHashes> levels;
+
+        for (const SimdLevelName& name : c_SimdLevelNames) {
+            if (name.Level > maxLevel)
+                break;
+
+            Mct::BatchedNoise::SetSimdLevelCap(name.Level);
+
+            LevelHashes& hashes = levels.emplace_back(LevelHashes{ .Level = name.Level });
+            hashes.Pipeline = HashTerrains(options, size);
+
+            for (const TerrainName& terrain : c_TerrainNames) {
+                hashes.Region  .push_back(HashTerrain(options, terrain.Type, size, false));
+                hashes.PerChunk.push_back(HashTerrain(options, terrain.Type, size, true));
+            }
+        }
+
+        Mct::BatchedNoise::SetSimdLevelCap(maxLevel);
+
+        std::printf("\nGolden hashes, seed %d, %d x %d chunks\n", options.Seed, size, size);
+
+        int mismatches = 0;
+
+        for (const LevelHashes& hashes : levels) {
+            for (size_t i = 0; i < hashes.Pipeline.size(); ++i) {
+                const char* name  = c_TerrainNames[i].Name;
+                const char* level = Mct::ToString(hashes.Level);
+                const auto  found = expected.find(name);
+
+                if (found == expected.end()) {
+                    std::printf("%-7s %-8s missing   got %016llx\n", level, name, static_cast<unsigned long long>(hashes.Pipeline[i]));
+                    ++mismatches;
+                }
+                else if (found->second != hashes.Pipeline[i]) {
+                    std::printf("%-7s %-8s MISMATCH  expected %016llx, got %016llx\n", level, name, found->second,
+                                static_cast<unsigned long long>(hashes.Pipeline[i]));
+                    ++mismatches;
+                }
+                else {
+                    std::printf("%-7s %-8s ok        %016llx\n", level, name, found->second);
+                }
+            }
+        }
+
+        std::printf("\nBare terrain by region tile and chunk by chunk, against %s region tiles\n", Mct::ToString(levels.front().Level));
+
+        for (const LevelHashes& hashes : levels) {
+            for (size_t i = 0; i < hashes.Region.size(); ++i) {
+                const uint64_t reference = levels.front().Region[i];
+                const bool     matches   = hashes.Region[i] == reference && hashes.PerChunk[i] == reference;
+
+                std::printf("%-7s %-8s %-9s region %016llx, chunks %016llx\n", Mct::ToString(hashes.Level), c_TerrainNames[i].Name,
+                            matches ? "ok" : "MISMATCH", static_cast<unsigned long long>(hashes.Region[i]),
+                            static_cast<unsigned long long>(hashes.PerChunk[i]));
+
+                mismatches += !matches;
+            }
+        }
+
+        return mismatches == 0 ? 0 : 1;
+    }
+
+    // Shared by the request coroutines of CheckRequests, which may outlive the World when broken.
+    struct RequestProbe {
+        std::atomic<int> LiveFrames{ 0 };
+        std::atomic<int> Resolved{ 0 };
+        std::atomic<int> Unloaded{ 0 };
+    };
+
+    Mct::DetachedTask AwaitRequest(Mct::ChunkManager& chunkManager, const Mct::ChunkCoord coord, const Mct::ChunkStage stage,
+                                   const Mct::ResumeOn resumeOn, std::shared_ptr<RequestProbe> probe)
+    {
+        // Counts this frame until it is freed, resumed to the end or destroyed unresumed.
+        struct FrameGuard {
+            RequestProbe& Probe;
+
+            explicit FrameGuard(RequestProbe& probe) : Probe(probe) { Probe.LiveFrames.fetch_add(1); }
+            ~FrameGuard() { Probe.LiveFrames.fetch_sub(1); }
+        } guard(*probe);
+
+        const std::shared_ptr<Mct::Chunk> chunk = co_await chunkManager.Request(coord, stage, resumeOn);
+        (chunk ? probe->Resolved : probe->Unloaded).fetch_add(1);
+    }
+
+    // Updates the world with the player alternating between two positions, so the range is rebuilt
+    // every frame, until done returns true or 30 seconds passed.
+    template<typename Done_T>
+    bool UpdateUntil(Mct::World& world, const glm::vec3 playerPos, const bool moving, Done_T&& done) {
+        const auto start = Clock_T::now();
+
+        for (int frame = 0; !done(); ++frame) {
+            if (Clock_T::now() - start > std::chrono::seconds(30))
+                return false;
+
+            const glm::vec3 offset(moving && frame % 2 == 1 ? static_cast<float>(Mct::WorldConst::ChunkSizeX) : 0.0f, 0.0f, 0.0f);
+            world.Update(0.001f, playerPos + offset, glm::vec3(0.0f));
+            ConsumeMeshes(world.GetStreaming().GetRenderableSet());
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        return true;
+    }
+
+    int CheckRequests(const Options& options) {
+        const std::shared_ptr<RequestProbe> probe = std::make_shared<RequestProbe>();
+        int failures = 0;
+
+        const auto expect = [&failures](const bool passed, const char* what) {
+            std::printf("%-60s %s\n", what, passed ? "ok" : "FAILED");
+            failures += !passed;
+        };
+
+        {
+            Mct::World world(Mct::WorldSettings{
+                .TerrainType { Mct::TerrainType::SuperFlat },
+                .Seed        { options.Seed                },
+                .WorkerCount { options.WorkerCount         }
+            });
+
+            Mct::ChunkManager& chunkManager = world.GetChunkManager();
+            const glm::vec3    spawn(8.0f, 100.0f, 8.0f);
+
+            AwaitRequest(chunkManager, { 0, 0 }, Mct::ChunkStage::Generated, Mct::ResumeOn::Worker,     probe);
+            AwaitRequest(chunkManager, { 1, 0 }, Mct::ChunkStage::Meshed,    Mct::ResumeOn::MainThread, probe);
+
+            expect(UpdateUntil(world, spawn, false, [&probe] { return probe->Resolved.load() == 2; }),
+                   "Requests in range resolve, on a worker and the main thread");
+
+            // Generated but never meshed that far out, unloaded by the next range update.
+            AwaitRequest(chunkManager, { 1000, 1000 }, Mct::ChunkStage::Meshed, Mct::ResumeOn::Worker, probe);
+
+            expect(UpdateUntil(world, spawn, true, [&probe] { return probe->Unloaded.load() == 1; }),
+                   "A request unloaded before its stage resumes with nullptr");
+
+            // Posted, accepted as waiters or resumable, left pending at shutdown.
+            for (int i = 0; i < 8; ++i) {
+                const Mct::ResumeOn resumeOn = i % 2 == 0 ? Mct::ResumeOn::Worker : Mct::ResumeOn::MainThread;
+                AwaitRequest(chunkManager, { 5000 + i, 5000 }, Mct::ChunkStage::Meshed, resumeOn, probe);
+                AwaitRequest(chunkManager, { i, 1 },           Mct::ChunkStage::Meshed, resumeOn, probe);
+
+                world.Update(0.001f, spawn, glm::vec3(0.0f));
+            }
+
+            // Continuations queued behind busy workers, discarded when the JobSystem stops.
+            Mct::JobSystem& jobSystem = world.GetJobSystem();
+
+            for (size_t i = 0; i < jobSystem.GetWorkerCount(); ++i) {
+                jobSystem.Submit(Mct::JobKind::IO, Mct::JobPriority::High, [] {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+                });
+            }
+
+            for (int i = 0; i < 8; ++i) {
+                AwaitRequest(chunkManager, { 0, 0 }, Mct::ChunkStage::Generated, Mct::ResumeOn::Worker, probe);
+            }
+
+            world.Update(0.001f, spawn, glm::vec3(0.0f));
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+
+        expect(probe->LiveFrames.load() == 0, "No request frame outlives the World");
+
+        return failures == 0 ? 0 : 1;
+    }
+}
+
+
+int main(int argc, char** argv) {
+    Options options;
+
+    if (!ParseOptions(argc, argv, options))
+        return 1;
+
+    if (options.MaxSimd) {
+        Mct::BatchedNoise::SetSimdLevelCap(*options.MaxSimd);
+    }
+
+    Mct::Log::Init();
+
+    Mct::BlockDataManager::Init();
+    Mct::BiomeDataManager::Init();
+
+    int result = 0;
+
+    if (!options.RecordGoldenPath.empty()) {
+        result = RecordGolden(options);
+    }
+    else if (!options.CheckGoldenPath.empty()) {
+        result = CheckGolden(options);
+    }
+    else if (options.CheckRequests) {
+        result = CheckRequests(options);
+    }
+    else {
+        result = RunPregen(options);
+    }
+
+    std::printf("Peak resident memory: %.1f MiB\n", static_cast<double>(GetPeakResidentBytes()) / (1024.0 * 1024.0));
+
+    Mct::Log::Shutdown();
+
+    return result;
+}